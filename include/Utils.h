@@ -2,18 +2,84 @@
 
 #include <string>
 #include <vector>
+#include <cstdint>
+#include <functional>
+#include <span>
 
 
 using namespace std;
 
 namespace cpp_utils {
     string demangle(const char* mangled);
+
+    // splitmix64 finalizer - cheap, well mixed 64-bit hash of a single value
+    uint64_t mixHash(uint64_t value);
+    // combines a running hash with one more value, order dependent
+    uint64_t hashCombine(uint64_t seed, uint64_t value);
+    // maps a 64-bit hash to a double in [0, 1)
+    double hashToUnit(uint64_t hash);
+
+    // calls fn(i) for every i in [0, n) on n_threads threads (0 - all hardware threads)
+    // indices are handed out dynamically, the first exception is rethrown after joining
+    void parallelFor(size_t n, int n_threads, const function<void(size_t)>& fn);
+
+    // Counter-based generator: the n-th output of (seed, stream) is a pure
+    // function of n, so independent streams and random access are free
+    class CounterRng {
+    public:
+        CounterRng(uint64_t seed = 0, uint64_t stream = 0, uint64_t counter = 0)
+            : key_(hashCombine(mixHash(seed), stream)), counter_(counter) { }
+
+        uint64_t operator()() { return at(counter_++); }
+        uint64_t at(uint64_t counter) const {
+            return mixHash(key_ + counter * 0x9e3779b97f4a7c15ULL);
+        }
+        double nextDouble() { return hashToUnit((*this)()); }
+        // uniform index in [0, n) from the top 32 bits, n must fit in 32 bits
+        size_t nextIndex(size_t n) { return ((*this)() >> 32) * n >> 32; }
+
+        uint64_t getCounter() const { return counter_; }
+        void setCounter(uint64_t counter) { counter_ = counter; }
+
+        // std::uniform_random_bit_generator interface
+        using result_type = uint64_t;
+        static constexpr uint64_t min() { return 0; }
+        static constexpr uint64_t max() { return UINT64_MAX; }
+
+    private:
+        uint64_t key_;
+        uint64_t counter_;
+    };
+
+    // index drawn with the given probabilities for u uniform in [0, 1),
+    // the last index absorbs rounding of the cumulative sum
+    size_t sampleIndex(span<const double> probabilities, double u);
+
+    // Mean, standard error and half width of the 95% normal confidence
+    // interval of every value over n_samples samples
+    struct SampleStatistics {
+        vector<double> means;
+        vector<double> standard_errors;
+        vector<double> confidence_95;
+    };
+
+    // Sums the values sample(i) returns for every i in [0, n_samples), in chunks
+    // of chunk_size on n_threads threads. Chunks are reduced in order, so the
+    // result does not depend on the thread count. sample returns the same
+    // number of values for every i.
+    SampleStatistics sampleInChunks(
+        size_t n_samples, size_t chunk_size, int n_threads,
+        const function<vector<double>(size_t)>& sample
+    );
 }
 
 namespace strategy_utils {
     vector<double> normalizeStrategy(
         const vector<double>& strategy
     );
+    // normalizeStrategy writing into a buffer of the same size,
+    // which may be the input itself
+    void normalizeStrategyInto(span<const double> strategy, span<double> normalized);
 
     // Each action gets at least epsilon / n probability
     // This is equivalent to, with probability "epsilon", selecting a random action uniformly
@@ -22,3 +88,30 @@ namespace strategy_utils {
         double epsilon, const vector<double>& strategy
     );
 }
+
+// Update of a decision node's sums in CFR+, shared by the solvers that keep
+// their sums in flat arrays instead of InfoSet
+namespace cfr_utils {
+    struct UpdateWeights {
+        // chance and opponent reach
+        double regret;
+        // reach of the player to move
+        double strategy;
+    };
+    UpdateWeights getUpdateWeights(
+        int player, double p_past_actions_p0, double p_past_actions_p1, double p_past_chances
+    );
+
+    // regrets of the player to move, action values and value are for player 0
+    void computeInstantRegrets(
+        int player, span<const double> action_values, double value, span<double> instant_regrets
+    );
+
+    // sums += weight * values
+    void accumulateWeighted(span<double> sums, double weight, span<const double> values);
+
+    // regret_sum += weight * instant_regrets, floored at zero
+    void accumulatePositiveRegret(
+        span<double> regret_sum, double weight, span<const double> instant_regrets
+    );
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include "abstract/infoset/InfoSetMap.h"
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <vector>
+
+using namespace std;
+
+/**
+ * @class ConcurrentInfoSetTable
+ * @brief Info set table shared by training threads without locks.
+ *
+ * Open addressing over a fixed array of atomic entry pointers: lookups are
+ * plain acquire loads, an insert publishes a new entry with a single
+ * compare-and-swap and the loser of a race adopts the winner's entry.
+ * The capacity is fixed at construction and entries are never moved or
+ * removed, so a reference to an entry stays valid for the table's lifetime.
+ *
+ * Entries keep regret and strategy sums as per-action atomics. Updates are
+ * lock-free and never lost, but an update of several actions is not atomic
+ * as a whole (hogwild). Strategies are computed into a caller's buffer from
+ * one load per action, so readers never write shared state and always see
+ * a valid distribution.
+ */
+template <InfoSetKey Key>
+class ConcurrentInfoSetTable {
+public:
+    class Entry {
+    public:
+        Entry(const Key& key, size_t n_actions);
+
+        const Key& getKey() const;
+        size_t getActionCount() const;
+
+        // regret matching over the positive part of the regret sum,
+        // uniform when no regret is positive
+        void getRegretSumStrategy(span<double> strategy) const;
+        // CFR+ update, as InfoSet::accumulateRegret: regret sums are clipped at zero
+        void accumulateRegret(double weight, span<const double> instant_regret);
+        void accumulateStrategy(double weight, span<const double> strategy);
+
+        vector<double> getRegretSum() const;
+        vector<double> getCumulativeStrategySum() const;
+
+    private:
+        Key key_;
+        size_t n_actions_;
+        // regret sums followed by strategy sums
+        unique_ptr<atomic<double>[]> sums_;
+    };
+
+    // capacity is rounded up to a power of two
+    explicit ConcurrentInfoSetTable(size_t capacity);
+    ~ConcurrentInfoSetTable();
+    ConcurrentInfoSetTable(const ConcurrentInfoSetTable&) = delete;
+    ConcurrentInfoSetTable& operator=(const ConcurrentInfoSetTable&) = delete;
+
+    // nullptr if the key is not in the table
+    Entry* find(const Key& key) const;
+    // throws length_error when the table is full
+    Entry& findOrInsert(const Key& key, size_t n_actions);
+
+    size_t size() const;
+    size_t getCapacity() const;
+
+    // snapshot as InfoSets, must not run concurrently with updates
+    InfoSetMap<Key> toInfoSetMap() const;
+
+private:
+    size_t getHomeSlot(const Key& key) const;
+
+    size_t mask_;
+    unique_ptr<atomic<Entry*>[]> slots_;
+    atomic<size_t> size_;
+};
+
+// Explicit instantiation declarations
+extern template class ConcurrentInfoSetTable<string>;
+extern template class ConcurrentInfoSetTable<size_t>;
+
+using ConcurrentInfoSetTableString = ConcurrentInfoSetTable<string>;
+using ConcurrentInfoSetTableInt = ConcurrentInfoSetTable<size_t>;
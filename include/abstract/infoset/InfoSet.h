@@ -16,11 +16,18 @@ class InfoSet {
     friend class infoset_utils::SaveLoader;
 
 public:
+    // regret sum of every action of a new info set
+    static constexpr double INITIAL_REGRET_SUM = 20.0; // TODO return to 0
+
     InfoSet(int n_actions);
+    // restores an info set from its accumulated sums
+    InfoSet(const vector<double>& regret_sum, const vector<double>& cumulative_strategy_sum);
     InfoSet(const InfoSet& other);
     
     const vector<double>& getInstantRegret() const;
     const vector<double>& getRegretSum() const;
+    // not normalized sum of weighted regretsum strategies
+    const vector<double>& getCumulativeStrategySum() const;
     const vector<double>& getRegretSumStrategy();
     const vector<double>& getCumulativeStrategy();
     vector<double> getRegretSumStrategy() const;
@@ -32,6 +39,19 @@ public:
 
     virtual void accumulateRegret(double weight);
     void accumulateStrategy(double weight);
+    // accumulates a given (played) strategy instead of the regretsum strategy
+    void accumulateStrategy(double weight, const vector<double>& strategy);
+
+    // Predictive CFR+: the prediction is the weighted instant regret of the
+    // last completed iteration, summed over all histories of the info set
+    // startIteration is called on every visit before the strategy is read,
+    // on the first visit of a new iteration the finished one becomes the prediction
+    void startIteration(int iteration);
+    // accumulateRegret that also adds the regret to the current iteration sum
+    void accumulatePredictiveRegret(double weight);
+    const vector<double>& getPredictedRegret() const;
+    // normalized positive part of regret sum + prediction
+    vector<double> getPredictiveStrategy() const;
 
 protected:
     vector<double> instant_regret_;
@@ -41,5 +61,9 @@ protected:
     vector<double> cumulative_strategy_not_norm_;
     bool cumulative_strategy_uptodate_;
     vector<double> cumulative_strategy_normalized_;
+    // only allocated by startIteration
+    vector<double> predicted_regret_;
+    vector<double> iteration_regret_;
+    int regret_iteration_;
 };
 
@@ -0,0 +1,121 @@
+#pragma once
+
+#include "abstract/infoset/InfoSetMap.h"
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <list>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace std;
+
+/**
+ * @class InfoSetStore
+ * @brief Info set sums in a memory-mapped file with a resident memory budget.
+ *
+ * Every info set is a record of regret sums followed by strategy sums,
+ * appended to a file in insertion order; only the key index and the record
+ * offsets stay on the heap. The file is divided into segments and at most
+ * memory_budget_bytes worth of segments are kept resident: accessing a
+ * spilled segment counts as a fault, makes it resident and evicts the least
+ * recently used segments, which are written back and dropped from memory.
+ *
+ * Inserting info sets in traversal order keeps a traversal moving forward
+ * through the file, and the segment after a faulting one is prefetched, so
+ * faults are mostly sequential reads.
+ *
+ * Spans returned by the accessors stay valid until the next insert.
+ */
+template <InfoSetKey Key>
+class InfoSetStore {
+public:
+    static constexpr size_t NOT_FOUND = numeric_limits<size_t>::max();
+
+    struct Params {
+        size_t memory_budget_bytes = size_t(1) << 30;
+        size_t segment_bytes = size_t(1) << 20;
+        // directory of the spill file, empty uses TMPDIR or /tmp,
+        // the file is unlinked right after creation
+        string directory = "";
+    };
+
+    struct Statistics {
+        size_t n_infosets;
+        size_t file_bytes;
+        size_t resident_segments;
+        size_t spilled_segments;
+        uint64_t n_accesses;
+        uint64_t n_faults;
+        uint64_t n_evictions;
+        uint64_t n_prefetches;
+        // faults per access
+        double fault_rate;
+    };
+
+    InfoSetStore(const Params& params = Params());
+    ~InfoSetStore();
+    InfoSetStore(const InfoSetStore&) = delete;
+    InfoSetStore& operator=(const InfoSetStore&) = delete;
+
+    // returns the id of the key, a new record starts from the given sums
+    size_t insert(
+        const Key& key,
+        span<const double> regret_sum,
+        span<const double> cumulative_strategy_sum
+    );
+    // id of the key or NOT_FOUND
+    size_t find(const Key& key) const;
+
+    size_t size() const;
+    size_t getActionCount(size_t id) const;
+    const Key& getKey(size_t id) const;
+
+    span<double> getRegretSum(size_t id);
+    span<double> getCumulativeStrategySum(size_t id);
+
+    Statistics getStatistics() const;
+
+    // materializes the whole store, only for tables that fit in memory
+    InfoSetMap<Key> toInfoSetMap();
+
+private:
+    // marks the segments of [begin, end) bytes as recently used, faulting them in
+    void touch(size_t begin, size_t end);
+    void makeResident(size_t segment);
+    void evictSegment(size_t segment);
+    void reserve(size_t file_bytes);
+
+    Params params_;
+    int fd_;
+    char* data_;
+    size_t mapped_bytes_;
+    size_t used_bytes_;
+
+    unordered_map<Key, size_t> ids_;
+    // keys of ids_ by id, elements of an unordered_map keep their address
+    vector<const Key*> keys_;
+    // record of id i occupies [record_offsets_[i], record_offsets_[i + 1]) bytes
+    vector<size_t> record_offsets_;
+
+    // resident segments, most recently used first
+    list<size_t> lru_;
+    vector<list<size_t>::iterator> lru_position_;
+    vector<char> resident_;
+    size_t n_resident_;
+    size_t max_resident_;
+
+    uint64_t n_accesses_;
+    uint64_t n_faults_;
+    uint64_t n_evictions_;
+    uint64_t n_prefetches_;
+};
+
+// Explicit instantiation declarations
+extern template class InfoSetStore<string>;
+extern template class InfoSetStore<size_t>;
+
+using InfoSetStoreString = InfoSetStore<string>;
+using InfoSetStoreInt = InfoSetStore<size_t>;
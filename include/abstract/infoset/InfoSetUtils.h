@@ -89,6 +89,31 @@ namespace infoset_utils {
     
     template <InfoSetKey Key>
     RegretMetric calculateMetric(const InfoSetMap<Key>& infoset_map);
+
+    // Contiguous copy of an InfoSetMap for bulk analysis
+    // values of info set i occupy [offsets[i], offsets[i + 1]) in every value array
+    template <InfoSetKey Key>
+    struct InfoSetArrays {
+        vector<Key> keys;
+        vector<size_t> offsets;
+        vector<double> instant_regret;
+        vector<double> regret_sum;
+        vector<double> strategy_sum;
+        // normalized strategy_sum
+        vector<double> average_strategy;
+    };
+
+    template <InfoSetKey Key>
+    InfoSetArrays<Key> toArrays(const InfoSetMap<Key>& infoset_map);
+
+    // Finds the info set of a node or adds it on the first visit,
+    // so a partially loaded map is completed during traversal;
+    // throws logic_error when an existing info set has a different number of actions
+    // inserted is set when the info set was added
+    template <InfoSetKey Key>
+    InfoSet& findOrAddInfoSet(
+        InfoSetMap<Key>& infoset_map, const Key& key, size_t n_actions, bool* inserted = nullptr
+    );
 };
 
 #include "abstract/infoset/InfoSetUtils.hpp"
\ No newline at end of file
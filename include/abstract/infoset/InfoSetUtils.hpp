@@ -1,7 +1,9 @@
 #pragma once
 
 #include "abstract/infoset/InfoSetUtils.h"
+#include "Utils.h"
 #include <fstream>
+#include <stdexcept>
 
 template <InfoSetKey Key>
 void infoset_utils::SaveLoader::saveInfoSetMapToFile(
@@ -274,4 +276,70 @@ infoset_utils::RegretMetric infoset_utils::calculateMetric(
     }
 
     return metric;
-}
\ No newline at end of file
+}
+
+
+
+template <InfoSetKey Key>
+infoset_utils::InfoSetArrays<Key> infoset_utils::toArrays(
+    const InfoSetMap<Key>& infoset_map
+) {
+    InfoSetArrays<Key> arrays;
+    arrays.keys.reserve(infoset_map.size());
+    arrays.offsets.reserve(infoset_map.size() + 1);
+
+    size_t n_values = 0;
+    for (const auto& [key, infoset] : infoset_map) {
+        n_values += infoset.getRegretSum().size();
+    }
+    arrays.instant_regret.reserve(n_values);
+    arrays.regret_sum.reserve(n_values);
+    arrays.strategy_sum.reserve(n_values);
+    arrays.average_strategy.reserve(n_values);
+
+    arrays.offsets.push_back(0);
+    for (const auto& [key, infoset] : infoset_map) {
+        const vector<double>& strategy_sum = infoset.getCumulativeStrategySum();
+
+        arrays.keys.push_back(key);
+        arrays.instant_regret.insert(
+            arrays.instant_regret.end(),
+            infoset.getInstantRegret().begin(), infoset.getInstantRegret().end()
+        );
+        arrays.regret_sum.insert(
+            arrays.regret_sum.end(),
+            infoset.getRegretSum().begin(), infoset.getRegretSum().end()
+        );
+        arrays.strategy_sum.insert(
+            arrays.strategy_sum.end(), strategy_sum.begin(), strategy_sum.end()
+        );
+
+        size_t offset = arrays.average_strategy.size();
+        arrays.average_strategy.resize(offset + strategy_sum.size());
+        strategy_utils::normalizeStrategyInto(
+            strategy_sum, span<double>(arrays.average_strategy).subspan(offset)
+        );
+        arrays.offsets.push_back(arrays.regret_sum.size());
+    }
+
+    return arrays;
+}
+
+
+template <InfoSetKey Key>
+InfoSet& infoset_utils::findOrAddInfoSet(
+    InfoSetMap<Key>& infoset_map, const Key& key, size_t n_actions, bool* inserted
+) {
+    auto [it, added] = infoset_map.try_emplace(key, n_actions);
+    if (inserted != nullptr) {
+        *inserted = added;
+    }
+    if (!added && it->second.getRegretSum().size() != n_actions) {
+        throw logic_error(
+            "Info set " + convertKey<Key, string>(key) + " has " +
+            to_string(it->second.getRegretSum().size()) + " actions, its node has " +
+            to_string(n_actions)
+        );
+    }
+    return it->second;
+}
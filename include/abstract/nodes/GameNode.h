@@ -8,6 +8,7 @@
 #include <typeinfo>
 #include <cxxabi.h>
 #include <cstdlib>
+#include <cstdint>
 #include "Utils.h"
 
 using namespace std;
@@ -48,6 +49,11 @@ using namespace std;
  * - size_t getInfoSetKeyInt() const - Returns information set identifier as integer value, 
  *   optional if string version is implemented, can be re-implemented for optimization
  * 
+ * **Optional, all node types:**
+ * - bool hasStateHash() const - Whether getStateHash is implemented, false by default
+ * - uint64_t getStateHash() const - Hash of the full game state. Nodes with equal hashes
+ *   must have identical subtrees, which lets evaluators memoize transpositions
+ * 
  * @note Calling inappropriate functions for a node type will throw logic_error exceptions.
  *       Derived classes must implement the appropriate virtual functions for their node type.
  */
@@ -77,6 +83,10 @@ public:
     virtual string getInfoSetKeyString() const;
     virtual size_t getInfoSetKeyInt() const;
 
+    // Optional state hash for memoizing identical subtrees
+    virtual bool hasStateHash() const;
+    virtual uint64_t getStateHash() const;
+
     template <typename Key>
     Key getInfoSetKey() const = delete;
 
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "abstract/nodes/GameNode.h"
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+/**
+ * @class MultiRootNode
+ * @brief Chance node whose outcomes are the roots of several games.
+ *
+ * Outcome i is roots[i] with probability weights[i] / sum(weights), so one
+ * solver over this node trains all roots together: info sets with the same
+ * key are shared between the roots and their regrets are weighted by the
+ * root weight. The roots must use the same info set keys for the same
+ * situations, e.g. subgames of one game.
+ */
+class MultiRootNode : public ChanceNode {
+public:
+    MultiRootNode(
+        const vector<shared_ptr<const GameNode>>& roots,
+        const vector<double>& weights
+    );
+
+    string toString() const override;
+    string actionToString(int action) const override;
+
+    const vector<double>& getChanceProbabilities() const override;
+    const vector<int>& getLegalActions() const override;
+    shared_ptr<const GameNode> applyAction(int action) const override;
+
+    size_t getRootCount() const;
+    // weights as given, not normalized
+    const vector<double>& getWeights() const;
+
+private:
+    vector<shared_ptr<const GameNode>> roots_;
+    vector<double> weights_;
+    vector<double> probabilities_;
+    vector<int> actions_;
+};
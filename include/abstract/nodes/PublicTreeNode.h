@@ -0,0 +1,76 @@
+#pragma once
+
+#include "abstract/nodes/GameNode.h"
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+/**
+ * @class PublicTreeNode
+ * @brief Node of a two-player public game tree, the input of vector-form solvers.
+ *
+ * All private information is dealt before the first action: player p holds
+ * one of getPrivateStateCount(p) private states, drawn jointly with
+ * probabilities getPrivateStatePrior(). Every action is public, so one node
+ * stands for the histories of all private state pairs with the same actions.
+ *
+ * Matrices over private state pairs are row-major, pair (s0, s1) is at
+ * s0 * getPrivateStateCount(1) + s1.
+ *
+ * **All Node Types:**
+ * - Type getType() const - Terminal or Decision, public chance nodes are not supported
+ * - size_t getPrivateStateCount(int player) const
+ * - const vector<double>& getPrivateStatePrior() const - joint probabilities of private states
+ *
+ * **Terminal Nodes:**
+ * - vector<double> getTerminalUtilityMatrix(int player) const - utility of the
+ *   player for every private state pair
+ *
+ * **Decision Nodes:**
+ * - int getCurrentPlayer() const
+ * - const vector<int>& getLegalActions() const
+ * - shared_ptr<const PublicTreeNode> applyAction(int action) const
+ * - string getInfoSetKeyString(size_t private_state) const and
+ *   size_t getInfoSetKeyInt(size_t private_state) const - key of the acting player's
+ *   info set, equal to the key of the corresponding GameNode
+ */
+class PublicTreeNode {
+public:
+    virtual GameNode::Type getType() const = 0;
+    virtual ~PublicTreeNode() = default;
+
+    string getTypeString() const;
+
+    virtual size_t getPrivateStateCount(int player) const = 0;
+    virtual const vector<double>& getPrivateStatePrior() const = 0;
+
+    // Function for Terminal Nodes
+    virtual vector<double> getTerminalUtilityMatrix(int player) const;
+
+    // Functions for Decision Nodes
+    virtual int getCurrentPlayer() const;
+    virtual const vector<int>& getLegalActions() const;
+    virtual shared_ptr<const PublicTreeNode> applyAction(int action) const;
+    virtual string getInfoSetKeyString(size_t private_state) const;
+    virtual size_t getInfoSetKeyInt(size_t private_state) const;
+
+    template <typename Key>
+    Key getInfoSetKey(size_t private_state) const = delete;
+
+protected:
+    // Throws an exception when a function is called on a node type that doesn't support it
+    [[noreturn]]
+    void throwWrongNodeTypeFnException(const string& funcName) const;
+};
+
+template <>
+inline size_t PublicTreeNode::getInfoSetKey<size_t>(size_t private_state) const {
+    return getInfoSetKeyInt(private_state);
+}
+
+template <>
+inline string PublicTreeNode::getInfoSetKey<string>(size_t private_state) const {
+    return getInfoSetKeyString(private_state);
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "abstract/strategy/PolicyTable.h"
+#include "Utils.h"
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
+using namespace std;
+
+/**
+ * @class ActionSampler
+ * @brief O(1) action sampling from a PolicyTable using Walker alias tables.
+ *
+ * Alias tables for all rows are built once (Vose's method) and stored in
+ * flat arrays that share the offsets of the policy table. A sample costs one
+ * 64-bit random number: the high half picks the column, the low half decides
+ * between the column and its alias.
+ *
+ * Samples are returned as action indices into the info set strategy, that is
+ * positions in the node's legal actions.
+ */
+template <InfoSetKey Key>
+class ActionSampler {
+public:
+    ActionSampler(shared_ptr<const PolicyTable<Key>> policy_table);
+
+    int sampleRow(size_t row, cpp_utils::CounterRng& rng) const;
+    // throws out_of_range for unknown keys
+    int sample(const Key& key, cpp_utils::CounterRng& rng) const;
+
+    // sample i uses counter start_counter + i of (seed, stream),
+    // so results do not depend on how a batch is split between threads
+    // unknown keys produce -1
+    void sampleBatch(
+        span<const Key> keys,
+        span<int> actions,
+        uint64_t seed,
+        uint64_t stream = 0,
+        uint64_t start_counter = 0
+    ) const;
+
+    const PolicyTable<Key>& getPolicyTable() const;
+
+private:
+    int sampleRowWith(size_t row, uint64_t random) const;
+
+    shared_ptr<const PolicyTable<Key>> policy_table_;
+    // probability of keeping the column, scaled to 2^32
+    vector<uint32_t> keep_threshold_;
+    vector<uint32_t> alias_;
+};
+
+// Explicit instantiation declarations
+extern template class ActionSampler<string>;
+extern template class ActionSampler<size_t>;
+
+using ActionSamplerString = ActionSampler<string>;
+using ActionSamplerInt = ActionSampler<size_t>;
@@ -0,0 +1,95 @@
+#pragma once
+
+#include "abstract/infoset/InfoSetMap.h"
+#include "abstract/nodes/GameNode.h"
+#include "abstract/strategy/PolicyTable.h"
+#include <memory>
+#include <vector>
+
+using namespace std;
+
+/**
+ * @class BestResponse
+ * @brief Exact best-response values and exploitability of a fixed strategy.
+ *
+ * The game tree is expanded once at construction into flat arrays, so the
+ * same instance can score many strategies during training. For every player
+ * the best response is found bottom-up over that player's info sets: an info
+ * set is resolved once all of its histories have their subtree values, and
+ * the action with the largest sum of reach-weighted counterfactual values
+ * (opponents and chance reach) is chosen for all of its histories at once.
+ * With perfect recall, info sets with the same number of the player's own
+ * earlier decisions have disjoint subtrees and are resolved in parallel.
+ */
+template <InfoSetKey Key>
+class BestResponse {
+public:
+    struct Result {
+        // value of the best response of player p against the others
+        vector<double> best_response_values;
+        // value of player p when everyone follows the strategy
+        vector<double> strategy_values;
+        // sum over players of best_response_values - strategy_values
+        double nash_conv;
+        // nash_conv / n_players, (br_0 + br_1) / 2 for two-player zero-sum games
+        double exploitability;
+    };
+
+    BestResponse(
+        shared_ptr<const GameNode> root,
+        MissingInfoSet missing_infoset = MissingInfoSet::Throw
+    );
+
+    // uses the normalized cumulative (average) strategy of every info set
+    Result compute(const InfoSetMap<Key>& strategy, int n_threads = 0) const;
+    // n_threads = 0 uses all hardware threads
+    Result compute(const PolicyTable<Key>& policy, int n_threads = 0) const;
+
+    int getPlayerCount() const;
+    size_t getNodeCount() const;
+    size_t getInfoSetCount() const;
+
+private:
+    size_t addNode(const shared_ptr<const GameNode>& node, vector<int>& own_decisions);
+    size_t getInfoSet(const shared_ptr<const GameNode>& node, int own_decisions);
+
+    // flattened strategy probabilities, info set i at [infoset_offsets_[i], infoset_offsets_[i + 1])
+    vector<double> collectStrategy(const PolicyTable<Key>& policy) const;
+
+    // value of the subtree for the best-responding player, memoized in values
+    double bestResponseValue(
+        size_t node, int player, const vector<double>& probabilities, vector<double>& values
+    ) const;
+
+    MissingInfoSet missing_infoset_;
+    int n_players_;
+
+    // nodes in preorder, so every child has a larger index than its parent
+    vector<GameNode::Type> node_type_;
+    vector<int> node_player_;
+    // info set id for decision nodes, offset into utilities_ for terminal nodes
+    vector<size_t> node_slot_;
+    // edges of node i are [node_first_edge_[i], node_first_edge_[i + 1])
+    vector<size_t> node_first_edge_;
+    vector<size_t> edge_child_;
+    // chance probability of the edge, unused for decision nodes
+    vector<double> edge_probability_;
+    vector<double> utilities_;
+
+    vector<Key> infoset_keys_;
+    vector<int> infoset_player_;
+    vector<size_t> infoset_offsets_;
+    vector<vector<size_t>> infoset_nodes_;
+    // number of earlier decisions of the info set's player, equal for all nodes with perfect recall
+    vector<int> infoset_level_;
+    // info sets of player p by the number of earlier own decisions
+    vector<vector<vector<size_t>>> player_levels_;
+    unordered_map<Key, size_t> infoset_ids_;
+};
+
+// Explicit instantiation declarations
+extern template class BestResponse<string>;
+extern template class BestResponse<size_t>;
+
+using BestResponseString = BestResponse<string>;
+using BestResponseInt = BestResponse<size_t>;
@@ -0,0 +1,83 @@
+#pragma once
+
+#include "abstract/nodes/GameNode.h"
+#include "abstract/strategy/PolicyTable.h"
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+using namespace std;
+
+/**
+ * @class HeadToHead
+ * @brief Exact expected utilities when every player follows its own strategy table.
+ *
+ * The game is expanded once at construction into flat arrays in postorder,
+ * so evaluating a strategy profile is a single forward sweep with no GameNode
+ * calls. Nodes reporting a state hash (GameNode::hasStateHash) are merged on
+ * that hash, turning transpositions into a shared subtree, and the sweep
+ * costs one step per unique state rather than per path. evaluateMatrix plays
+ * every pair of tables of a two-player tournament in parallel.
+ */
+template <InfoSetKey Key>
+class HeadToHead {
+public:
+    using Policy = shared_ptr<const PolicyTable<Key>>;
+
+    HeadToHead(
+        shared_ptr<const GameNode> root,
+        MissingInfoSet missing_infoset = MissingInfoSet::Throw
+    );
+
+    // expected utilities of all players, player p follows player_policies[p]
+    vector<double> evaluate(const vector<Policy>& player_policies) const;
+
+    // two-player games, result[i][j] = utilities of policies[i] as player 0
+    // against policies[j] as player 1, n_threads = 0 uses all hardware threads
+    vector<vector<vector<double>>> evaluateMatrix(
+        const vector<Policy>& policies, int n_threads = 0
+    ) const;
+
+    int getPlayerCount() const;
+    // unique nodes after merging equal state hashes
+    size_t getNodeCount() const;
+    size_t getInfoSetCount() const;
+
+private:
+    size_t addNode(const shared_ptr<const GameNode>& node);
+    size_t getInfoSet(const shared_ptr<const GameNode>& node);
+
+    // strategy of the player's info sets laid out by infoset_offsets_, zeros elsewhere
+    vector<double> collectStrategy(const PolicyTable<Key>& policy, int player) const;
+    // utilities at the root, info sets of player p use player_probabilities[p]
+    vector<double> sweep(const vector<const vector<double>*>& player_probabilities) const;
+
+    MissingInfoSet missing_infoset_;
+    int n_players_;
+
+    // nodes in postorder, so every child has a smaller index than its parent
+    vector<GameNode::Type> node_type_;
+    // info set id for decision nodes, offset into utilities_ for terminal nodes
+    vector<size_t> node_slot_;
+    // edges of node i are [node_first_edge_[i], node_first_edge_[i + 1])
+    vector<size_t> node_first_edge_;
+    vector<size_t> edge_child_;
+    // chance probability of the edge, unused for decision nodes
+    vector<double> edge_probability_;
+    vector<double> utilities_;
+
+    vector<Key> infoset_keys_;
+    vector<int> infoset_player_;
+    vector<size_t> infoset_offsets_;
+    unordered_map<Key, size_t> infoset_ids_;
+    // state hash -> node, only used during construction
+    unordered_map<uint64_t, size_t> state_nodes_;
+};
+
+// Explicit instantiation declarations
+extern template class HeadToHead<string>;
+extern template class HeadToHead<size_t>;
+
+using HeadToHeadString = HeadToHead<string>;
+using HeadToHeadInt = HeadToHead<size_t>;
@@ -0,0 +1,112 @@
+#pragma once
+
+#include "abstract/nodes/GameNode.h"
+#include "abstract/strategy/ActionSampler.h"
+#include "abstract/strategy/PolicyTable.h"
+#include "Utils.h"
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+using namespace std;
+
+/**
+ * @class LocalBestResponse
+ * @brief Sampling lower bound on exploitability for games too large for BestResponse.
+ *
+ * The exploiter plays real games against the fixed policy. At each of its
+ * decisions it scores every action with rollouts in which all players,
+ * the exploiter included, follow the policy, and takes the best one.
+ * Rollouts start from histories drawn from the exploiter's belief, never from
+ * the hidden true history, so the exploiter's play depends only on its
+ * info sets and the mean utility it wins is a valid lower bound on its best
+ * response value. The belief is a particle filter: particles are played
+ * forward with chance and policy actions alongside the real game, and only
+ * particles reaching the exploiter's current info set survive. If none
+ * survive, the belief is redrawn by rejection sampling: histories are played
+ * from the root with chance and policy actions and the exploiter's own past
+ * actions, and those reaching the current info set are kept. If that also
+ * fails within n_resample_histories tries, the exploiter plays the policy at
+ * that decision, which is counted in n_belief_failures. Every game is kept,
+ * so the bound holds. Games are parallel and reduced in fixed chunks, so the
+ * result for a seed does not depend on the number of threads.
+ */
+template <InfoSetKey Key>
+class LocalBestResponse {
+public:
+    struct Params {
+        // histories kept in the belief of the exploiter
+        size_t n_particles = 64;
+        // rollouts per action at every exploiter decision
+        size_t n_rollouts = 32;
+        // histories played from the root to redraw an empty belief
+        size_t n_resample_histories = 4096;
+    };
+
+    struct Result {
+        int exploiter;
+        size_t n_games;
+        double mean_value;
+        double standard_error;
+        // half width of the 95% normal confidence interval
+        double confidence_95;
+        // exploiter decisions without any history consistent with the info set,
+        // where the policy action was played
+        size_t n_belief_failures;
+    };
+
+    // two-player zero-sum estimate: exploitability >= mean of both exploiters' values
+    struct ExploitabilityEstimate {
+        vector<Result> players;
+        double exploitability;
+        double confidence_95;
+    };
+
+    LocalBestResponse(
+        shared_ptr<const GameNode> root,
+        shared_ptr<const PolicyTable<Key>> policy,
+        Params params = Params(),
+        MissingInfoSet missing_infoset = MissingInfoSet::Throw
+    );
+
+    // n_threads = 0 uses all hardware threads
+    Result run(int exploiter, size_t n_games, uint64_t seed, int n_threads = 0) const;
+    ExploitabilityEstimate estimateExploitability(
+        size_t n_games, uint64_t seed, int n_threads = 0
+    ) const;
+
+    // exploiter utility of one game played with random stream game_idx of the seed
+    double playGame(
+        int exploiter, uint64_t seed, uint64_t game_idx, size_t* n_belief_failures = nullptr
+    ) const;
+
+    static constexpr size_t GAMES_PER_CHUNK = 16;
+
+private:
+    size_t sampleActionIdx(const GameNode& node, cpp_utils::CounterRng& rng) const;
+    // plays chance and policy actions until a decision of the exploiter or a terminal node
+    shared_ptr<const GameNode> advance(
+        shared_ptr<const GameNode> node, int exploiter, cpp_utils::CounterRng& rng
+    ) const;
+    double rollout(
+        shared_ptr<const GameNode> node, int exploiter, cpp_utils::CounterRng& rng
+    ) const;
+    // plays from the root with the exploiter's past actions, returns the
+    // exploiter's next decision if it is in the info set key, else nullptr
+    shared_ptr<const GameNode> sampleHistory(
+        int exploiter, const vector<int>& exploiter_actions, const Key& key,
+        cpp_utils::CounterRng& rng
+    ) const;
+
+    shared_ptr<const GameNode> root_;
+    ActionSampler<Key> sampler_;
+    Params params_;
+    MissingInfoSet missing_infoset_;
+};
+
+// Explicit instantiation declarations
+extern template class LocalBestResponse<string>;
+extern template class LocalBestResponse<size_t>;
+
+using LocalBestResponseString = LocalBestResponse<string>;
+using LocalBestResponseInt = LocalBestResponse<size_t>;
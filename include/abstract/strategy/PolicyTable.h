@@ -0,0 +1,72 @@
+#pragma once
+
+#include "abstract/infoset/InfoSetMap.h"
+#include <cstddef>
+#include <limits>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+using namespace std;
+
+// what strategy consumers do when an info set is missing from the table
+enum class MissingInfoSet { Throw, Uniform };
+
+/**
+ * @class PolicyTable
+ * @brief Read-only, normalized snapshot of a trained strategy for fast queries.
+ *
+ * Cumulative strategies of an InfoSetMap are normalized once at construction
+ * and stored back to back in a single array. Every info set becomes a row,
+ * found by key through one hash lookup. Batch queries resolve many keys
+ * in a single call and copy the strategies into a caller-provided buffer.
+ */
+template <InfoSetKey Key>
+class PolicyTable {
+public:
+    static constexpr size_t NOT_FOUND = numeric_limits<size_t>::max();
+
+    PolicyTable(const InfoSetMap<Key>& infoset_map);
+
+    size_t size() const;
+    size_t getMaxActions() const;
+    bool contains(const Key& key) const;
+
+    // row index of the key or NOT_FOUND
+    size_t findRow(const Key& key) const;
+    span<const double> getRowStrategy(size_t row) const;
+    // throws out_of_range for unknown keys
+    span<const double> getStrategy(const Key& key) const;
+
+    // rows[i] = findRow(keys[i])
+    void findRows(span<const Key> keys, span<size_t> rows) const;
+
+    // writes strategy of keys[i] into out[i * row_width, (i + 1) * row_width)
+    // padding with zeros, rows of unknown keys are all zeros
+    // n_actions[i] receives the number of actions, 0 for unknown keys
+    void getStrategies(
+        span<const Key> keys,
+        span<double> out,
+        size_t row_width,
+        span<size_t> n_actions = {}
+    ) const;
+
+    const vector<Key>& getKeys() const;
+    const vector<size_t>& getOffsets() const;
+    const vector<double>& getProbabilities() const;
+
+private:
+    unordered_map<Key, size_t> rows_;
+    vector<Key> keys_;
+    // strategy of row i occupies [offsets_[i], offsets_[i + 1]) in probabilities_
+    vector<size_t> offsets_;
+    vector<double> probabilities_;
+    size_t max_actions_;
+};
+
+// Explicit instantiation declarations
+extern template class PolicyTable<string>;
+extern template class PolicyTable<size_t>;
+
+using PolicyTableString = PolicyTable<string>;
+using PolicyTableInt = PolicyTable<size_t>;
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "abstract/nodes/GameNode.h"
+#include "abstract/strategy/ActionSampler.h"
+#include "abstract/strategy/PolicyTable.h"
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+using namespace std;
+
+/**
+ * @class Simulator
+ * @brief Parallel Monte Carlo estimate of game value under fixed strategies.
+ *
+ * Plays complete games from the root, sampling chance outcomes from
+ * getChanceProbabilities and decisions from each player's own policy table
+ * (alias sampling). Game g always uses random stream g of the seed, and games
+ * are summed in fixed-size chunks combined in chunk order, so the result
+ * for a given seed does not depend on the number of threads.
+ */
+template <InfoSetKey Key>
+class Simulator {
+public:
+    struct Result {
+        size_t n_games;
+        vector<double> mean_utilities;
+        vector<double> standard_errors;
+        // half width of the 95% normal confidence interval
+        vector<double> confidence_95;
+    };
+
+    // policy of player p is player_policies[p], the same table can be shared
+    Simulator(
+        shared_ptr<const GameNode> root,
+        const vector<shared_ptr<const PolicyTable<Key>>>& player_policies,
+        MissingInfoSet missing_infoset = MissingInfoSet::Throw
+    );
+
+    // n_threads = 0 uses all hardware threads
+    Result run(size_t n_games, uint64_t seed, int n_threads = 0) const;
+
+    // utilities of a single game played with random stream game_idx of the seed
+    vector<double> playGame(uint64_t seed, uint64_t game_idx) const;
+
+    static constexpr size_t GAMES_PER_CHUNK = 256;
+
+private:
+    shared_ptr<const GameNode> root_;
+    vector<ActionSampler<Key>> samplers_;
+    // index into samplers_ for each player
+    vector<size_t> player_sampler_;
+    MissingInfoSet missing_infoset_;
+};
+
+// Explicit instantiation declarations
+extern template class Simulator<string>;
+extern template class Simulator<size_t>;
+
+using SimulatorString = Simulator<string>;
+using SimulatorInt = Simulator<size_t>;
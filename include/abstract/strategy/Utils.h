@@ -1,6 +1,9 @@
+#pragma once
+
 #include "abstract/infoset/InfoSet.h"
 #include "abstract/infoset/InfoSetMap.h"
 #include "abstract/nodes/GameNode.h"
+#include <unordered_map>
 
 
 namespace strategy_utils {
@@ -10,6 +13,28 @@ namespace strategy_utils {
         shared_ptr<const GameNode> node,
         const InfoSetMap<ISKey>& infoset_strategy
     );
+
+    template <InfoSetKey ISKey>
+    struct MemoizedEvaluation {
+        // node value for player 0, same as evaluateNode
+        double root_value;
+        // expected value for player 0 given that the info set is reached,
+        // only filled when requested, unreachable info sets are left out
+        unordered_map<ISKey, double> infoset_values;
+        size_t n_evaluated_states;
+        size_t n_cache_hits;
+    };
+
+    // evaluateNode that caches subtree values of nodes with a state hash
+    // (GameNode::hasStateHash) in a direct-mapped transposition table that
+    // grows up to max_cached_states entries, colliding states replace each other
+    template <InfoSetKey ISKey>
+    MemoizedEvaluation<ISKey> evaluateNodeMemoized(
+        shared_ptr<const GameNode> node,
+        const InfoSetMap<ISKey>& infoset_strategy,
+        size_t max_cached_states = 1 << 20,
+        bool compute_infoset_values = false
+    );
 }
 
 #include "abstract/strategy/Utils.hpp"
\ No newline at end of file
@@ -1,7 +1,11 @@
 #pragma once
 
 #include "abstract/strategy/Utils.h"
+#include <algorithm>
+#include <limits>
 #include <stdexcept>
+#include <utility>
+#include <vector>
 
 template <InfoSetKey ISKey>
 double strategy_utils::evaluateNode(
@@ -53,3 +57,195 @@ double strategy_utils::evaluateNode(
             throw logic_error("Unknown node type in evaluateNode");
     }
 }
+
+
+namespace strategy_utils::detail {
+    template <InfoSetKey ISKey>
+    class MemoizedEvaluator {
+    public:
+        MemoizedEvaluator(
+            const InfoSetMap<ISKey>& infoset_strategy,
+            size_t max_cached_states,
+            bool record_states
+        ) :
+            infoset_strategy_(infoset_strategy),
+            max_table_size_(max(max_cached_states, (size_t) 1)),
+            table_(min(max_table_size_, INITIAL_TABLE_SIZE)),
+            record_states_(record_states)
+        { }
+
+        // returns (value, index of the recorded state)
+        pair<double, size_t> evaluate(const shared_ptr<const GameNode>& node) {
+            bool hashed = node->hasStateHash();
+            uint64_t state_hash = 0;
+            if (hashed) {
+                state_hash = node->getStateHash();
+                const Entry& entry = table_[state_hash % table_.size()];
+                if (entry.used && entry.hash == state_hash) {
+                    n_cache_hits++;
+                    return {entry.value, entry.state};
+                }
+            }
+            n_evaluated_states++;
+
+            double value = 0.0;
+            size_t infoset = NO_INFOSET;
+            vector<size_t> children;
+            vector<double> probabilities;
+
+            switch (node->getType()) {
+                case GameNode::Type::Terminal:
+                    value = node->getTerminalUtilities()[0];
+                    break;
+
+                case GameNode::Type::Chance:
+                    probabilities = node->getChanceProbabilities();
+                    break;
+
+                case GameNode::Type::Decision: {
+                    ISKey infoset_key = node->getInfoSetKey<ISKey>();
+                    auto it = infoset_strategy_.find(infoset_key);
+                    if (it == infoset_strategy_.end()) {
+                        throw runtime_error("InfoSet not found for key in strategy map");
+                    }
+                    probabilities = it->second.getCumulativeStrategy();
+                    if (record_states_) {
+                        infoset = infosets_.emplace(infoset_key, infosets_.size()).first->second;
+                    }
+                    break;
+                }
+            }
+
+            if (node->getType() != GameNode::Type::Terminal) {
+                const auto& legal_actions = node->getLegalActions();
+                for (size_t i = 0; i < legal_actions.size(); ++i) {
+                    auto [child_value, child_state] = evaluate(node->applyAction(legal_actions[i]));
+                    value += probabilities[i] * child_value;
+                    children.push_back(child_state);
+                }
+            }
+
+            size_t state = record(value, infoset, children, probabilities);
+            if (hashed) {
+                store({true, state_hash, value, state});
+            }
+            return {value, state};
+        }
+
+        // reach-weighted average of state values per info set, root is the last recorded state
+        unordered_map<ISKey, double> infosetValues() const {
+            size_t n_states = state_value_.size();
+            vector<double> reach(n_states, 0.0);
+            reach[n_states - 1] = 1.0;
+
+            vector<double> weighted_values(infosets_.size(), 0.0);
+            vector<double> reach_sums(infosets_.size(), 0.0);
+            // postorder, every parent comes after its children
+            for (size_t state = n_states; state-- > 0;) {
+                if (state_infoset_[state] != NO_INFOSET) {
+                    weighted_values[state_infoset_[state]] += reach[state] * state_value_[state];
+                    reach_sums[state_infoset_[state]] += reach[state];
+                }
+                for (size_t edge = state_first_edge_[state]; edge < state_first_edge_[state + 1]; edge++) {
+                    reach[edge_child_[edge]] += reach[state] * edge_probability_[edge];
+                }
+            }
+
+            unordered_map<ISKey, double> values;
+            for (const auto& [key, infoset] : infosets_) {
+                if (reach_sums[infoset] > 0) {
+                    values.emplace(key, weighted_values[infoset] / reach_sums[infoset]);
+                }
+            }
+            return values;
+        }
+
+        size_t n_evaluated_states = 0;
+        size_t n_cache_hits = 0;
+
+    private:
+        static constexpr size_t NO_INFOSET = numeric_limits<size_t>::max();
+        // small games never touch most of a large table, so it starts small
+        static constexpr size_t INITIAL_TABLE_SIZE = 1 << 12;
+
+        struct Entry {
+            bool used = false;
+            uint64_t hash = 0;
+            double value = 0.0;
+            size_t state = 0;
+        };
+
+        // doubles the table up to max_table_size_ once it is half full,
+        // children may have grown it since the lookup
+        void store(const Entry& new_entry) {
+            Entry& entry = table_[new_entry.hash % table_.size()];
+            n_used_entries_ += !entry.used;
+            entry = new_entry;
+            if (2 * n_used_entries_ <= table_.size() || table_.size() == max_table_size_) {
+                return;
+            }
+            vector<Entry> old_table(min(2 * table_.size(), max_table_size_));
+            swap(table_, old_table);
+            n_used_entries_ = 0;
+            for (const Entry& old_entry : old_table) {
+                if (old_entry.used) {
+                    Entry& moved = table_[old_entry.hash % table_.size()];
+                    n_used_entries_ += !moved.used;
+                    moved = old_entry;
+                }
+            }
+        }
+
+        size_t record(
+            double value, size_t infoset,
+            const vector<size_t>& children, const vector<double>& probabilities
+        ) {
+            if (!record_states_) {
+                return 0;
+            }
+            if (state_first_edge_.empty()) {
+                state_first_edge_.push_back(0);
+            }
+            state_value_.push_back(value);
+            state_infoset_.push_back(infoset);
+            edge_child_.insert(edge_child_.end(), children.begin(), children.end());
+            edge_probability_.insert(edge_probability_.end(), probabilities.begin(), probabilities.end());
+            state_first_edge_.push_back(edge_child_.size());
+            return state_value_.size() - 1;
+        }
+
+        const InfoSetMap<ISKey>& infoset_strategy_;
+        size_t max_table_size_;
+        vector<Entry> table_;
+        size_t n_used_entries_ = 0;
+        bool record_states_;
+
+        // evaluated states in postorder, only kept for info-set values
+        vector<double> state_value_;
+        vector<size_t> state_infoset_;
+        vector<size_t> state_first_edge_;
+        vector<size_t> edge_child_;
+        vector<double> edge_probability_;
+        unordered_map<ISKey, size_t> infosets_;
+    };
+}
+
+template <InfoSetKey ISKey>
+strategy_utils::MemoizedEvaluation<ISKey> strategy_utils::evaluateNodeMemoized(
+    shared_ptr<const GameNode> node,
+    const InfoSetMap<ISKey>& infoset_strategy,
+    size_t max_cached_states,
+    bool compute_infoset_values
+) {
+    detail::MemoizedEvaluator<ISKey> evaluator(
+        infoset_strategy, max_cached_states, compute_infoset_values
+    );
+    MemoizedEvaluation<ISKey> result;
+    result.root_value = evaluator.evaluate(node).first;
+    if (compute_infoset_values) {
+        result.infoset_values = evaluator.infosetValues();
+    }
+    result.n_evaluated_states = evaluator.n_evaluated_states;
+    result.n_cache_hits = evaluator.n_cache_hits;
+    return result;
+}
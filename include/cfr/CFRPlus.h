@@ -2,9 +2,14 @@
 #include "abstract/nodes/GameNode.h"
 #include "abstract/infoset/InfoSet.h"
 #include "abstract/infoset/InfoSetMap.h"
+#include "abstract/infoset/InfoSetUtils.h"
+#include "Utils.h"
 #include <unordered_map>
 #include <memory>
 #include <vector>
+#include <cstdint>
+#include <functional>
+#include <stop_token>
 
 using namespace std;
 
@@ -16,23 +21,75 @@ public:
         Builder& setRootNode(shared_ptr<const GameNode> root_node);
         Builder& setInitialEvaluationRun(bool initial_evaluation_run);
         Builder& setESoftRegsumStrategies(double e_soft_regsum_strategies);
+        // copied into every solver built; may be partial, e.g. a checkpoint
+        // of an older game version:
+        // missing info sets are added on their first visit and an info set
+        // with a different number of actions than its node throws logic_error
         Builder& setInitialState(const InfoSetMap<ISKey>& initial_state);
+        // works on shared_state directly instead of a copy of the initial
+        // state: regrets, strategies and new info sets are written into it, so
+        // solvers and evaluators holding the same map see each other's updates
+        // and many subgames can be evaluated from one trained map without
+        // duplicating it. Solvers sharing a map must not run concurrently.
+        // Replaces setInitialState and vice versa
+        Builder& setSharedState(shared_ptr<InfoSetMap<ISKey>> shared_state);
+        // Predictive CFR+, see CFRPlus constructor
+        Builder& setPredictive(bool predictive);
+        // chance sampling in updating iterations, see CFRPlus constructor
+        Builder& setChanceSampling(bool chance_sampling);
+        Builder& setSeed(uint64_t seed);
+        // deterministic parallel iterations, see CFRPlus constructor
+        Builder& setParallel(bool parallel);
+        Builder& setThreadCount(int n_threads);
+        // expected number of info sets, see CFRPlus constructor
+        Builder& setInfoSetCapacityHint(size_t infoset_capacity_hint);
         CFRPlus buildCfr();
         
     private:
+        friend class CFRPlus;
+
         shared_ptr<const GameNode> root_node_;
         bool initial_evaluation_run_ = true;
         double e_soft_regsum_strategies_ = 0;
-        InfoSetMap<ISKey> initial_state_ = InfoSetMap<ISKey>();
+        InfoSetMap<ISKey> initial_state_;
+        shared_ptr<InfoSetMap<ISKey>> shared_state_;
+        bool predictive_ = false;
+        bool chance_sampling_ = false;
+        uint64_t seed_ = 0;
+        bool parallel_ = false;
+        int n_threads_ = 0;
+        size_t infoset_capacity_hint_ = 0;
     };
 
     CFRPlus(
         shared_ptr<const GameNode> root_node,
         bool initial_evaluation_run = true,
         double e_soft_regsum_strategies = 0,
-        const InfoSetMap<ISKey>& initial_state = InfoSetMap<ISKey>()
+        const InfoSetMap<ISKey>& initial_state = InfoSetMap<ISKey>(),
+        // predictive regret matching: strategies follow regret sum plus
+        // the last iteration's instant regrets (InfoSet::getPredictiveStrategy)
+        // and the cumulative strategy averages the strategies actually played
+        bool predictive = false,
+        // iterations that accumulate regrets or strategy follow one sampled
+        // outcome per chance node visit instead of expanding all outcomes,
+        // the sampling probability cancels the outcome's chance reach so the
+        // regrets stay unbiased; evaluateRegretSum always expands full width
+        bool chance_sampling = false,
+        uint64_t seed = 0,
+        // iterations run on n_threads (0 = all hardware threads) with strategies
+        // fixed for the whole iteration; regrets and strategies are summed per
+        // work item and reduced in a fixed order, so the results are
+        // bit-identical for every thread count, including 1. The sequential
+        // mode instead updates an info set after every history, which cannot
+        // be parallelized exactly. Not combinable with chance_sampling.
+        bool parallel = false,
+        int n_threads = 0,
+        // info sets are created on their first visit (parallel iterations
+        // create all of them upfront), the hint reserves the map to avoid
+        // rehashing while it grows; with initial_evaluation_run = false the
+        // first iteration creates them and no extra traversal is made
+        size_t infoset_capacity_hint = 0
     );
-    
 
     // returns game utility at the root node for player 0 
     // if playing regretsum-based strategy
@@ -43,11 +100,45 @@ public:
         bool accumulate_strategy = true
     );
 
-    // does not accumulate regrets in infosets
+    // does not accumulate regrets in infosets, but creates the ones it visits,
+    // in a shared map as well
     // (!) Note: evaluation is node using regretsum strategies, not cumulative strategy
     double evaluateRegretSum();
+
+    struct TrainingProgress {
+        int iteration;
+        int n_iterations;
+        double root_value;
+        infoset_utils::RegretMetric metric;
+    };
+    // return false to stop training
+    using ProgressCallback = function<bool(const TrainingProgress&)>;
+
+    // runs n_iterations of evaluateAndUpdateRegretSum,
+    // strategy is accumulated only after the first strategy_delay iterations
+    // callback is called at most once per callback_interval_seconds and after the last iteration
+    // training stops early when the callback returns false or stop is requested
+    // returns the number of completed iterations
+    int train(
+        int n_iterations,
+        int strategy_delay = 0,
+        const ProgressCallback& callback = nullptr,
+        double callback_interval_seconds = 1.0,
+        stop_token stop = {}
+    );
     
+    // every info set below the root: ones no traversal has visited yet, e.g.
+    // below outcomes skipped by chance sampling, are created first with
+    // initial sums, in a shared map as well
     const InfoSetMap<ISKey>& getStrategyInfoSets();
+    // the map the solver works on, to share it with other solvers without a copy
+    shared_ptr<InfoSetMap<ISKey>> getSharedInfoSets();
+    // info sets added by the solver, i.e. not present in the initial state
+    size_t getCreatedInfoSetCount() const;
+    // values for player 0 of the root's outcomes in the last full-width
+    // iteration when the root is a chance node, e.g. a MultiRootNode;
+    // empty otherwise
+    const vector<double>& getRootOutcomeValues() const;
     
     // run with accumulate flags to control regret and strategy accumulation
     // and get node value for player 0
@@ -89,12 +180,85 @@ private:
         const shared_ptr<const GameNode> node
     );
 
-    void initInfoStates();
-    void initInfoStatesRecursively(const shared_ptr<const GameNode> node);
+    explicit CFRPlus(const Builder& builder);
+
+    // creates the info sets below node, for parallel iterations
+    // also gives each a dense id in visit order
+    void createInfoSets(const shared_ptr<const GameNode> node);
+    InfoSet& getInfoSet(const ISKey& infoset_key, size_t n_actions);
+
+    // Deterministic parallel iterations.
+    // work_depth_ is the smallest depth with at least MIN_WORK_ITEMS nodes,
+    // a fixed property of the game so the reduction order never depends on threads
+    static constexpr size_t MIN_WORK_ITEMS = 64;
+    // The tree down to work_depth_ is the prefix, processed sequentially,
+    // every node at work_depth_ is a work item processed by a worker thread.
+    struct WorkItem {
+        shared_ptr<const GameNode> node;
+        double p_past_actions_p0;
+        double p_past_actions_p1;
+        double p_past_chances;
+        double value;
+    };
+    // dense per-thread accumulators indexed by infoset_offsets_
+    struct ReductionBuffer {
+        vector<double> regrets;
+        vector<double> strategies;
+        vector<size_t> touched_ids;
+        vector<char> is_touched;
+    };
+    // sums of one work item for the info sets it touched, ids ascending
+    struct PartialSums {
+        vector<size_t> ids;
+        vector<double> regrets;
+        vector<double> strategies;
+    };
+
+    void initParallel();
+    double runParallelIteration(bool accumulate_regsum, bool accumulate_strategy);
+    enum class PrefixPass {
+        None,           // inside a work item
+        CollectItems,   // records nodes at work_depth_ with their reach
+        UseItems        // uses the values of the recorded items in the same order
+    };
+    // processNode that reads strategies_ and adds weighted regrets to the buffer
+    double processBufferedNode(
+        const shared_ptr<const GameNode>& node,
+        int depth,
+        double p_past_actions_p0,
+        double p_past_actions_p1,
+        double p_past_chances,
+        bool accumulate_strategy,
+        ReductionBuffer& buffer,
+        PrefixPass pass,
+        size_t& next_item
+    );
+    void extractPartialSums(ReductionBuffer& buffer, PartialSums& partial) const;
     
     const shared_ptr<const GameNode> root_node_;
-    InfoSetMap<ISKey> infosets_;
+    shared_ptr<InfoSetMap<ISKey>> infosets_;
     double e_soft_regsum_strategies_;
+    bool predictive_;
+    // number of completed regret-accumulating iterations
+    int iteration_;
+    size_t n_created_infosets_;
+    // a full-width traversal or createInfoSets has run from the root
+    bool all_infosets_created_;
+    vector<double> root_outcome_values_;
+    bool chance_sampling_;
+    cpp_utils::CounterRng rng_;
+
+    bool parallel_;
+    int n_threads_;
+    int work_depth_;
+    vector<WorkItem> work_items_;
+    // dense info set ids, strategy of id i is [infoset_offsets_[i], infoset_offsets_[i + 1])
+    unordered_map<ISKey, size_t> infoset_ids_;
+    vector<ISKey> infoset_keys_;
+    vector<size_t> infoset_offsets_;
+    // strategies of the current iteration: traversed (e-soft) and accumulated
+    vector<double> strategies_;
+    vector<double> played_strategies_;
 };
 
 // Explicit instantiation declarations
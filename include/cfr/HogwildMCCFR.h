@@ -0,0 +1,62 @@
+#pragma once
+#include "abstract/nodes/GameNode.h"
+#include "abstract/infoset/ConcurrentInfoSetTable.h"
+#include "abstract/infoset/InfoSetMap.h"
+#include "Utils.h"
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+using namespace std;
+
+/**
+ * @class HogwildMCCFR
+ * @brief External sampling MCCFR trained by many threads on one shared table.
+ *
+ * Every iteration traverses the game once per player: the traverser's
+ * actions are all expanded, the opponents' actions and chance outcomes are
+ * sampled. Iterations run in parallel without synchronization, all threads
+ * update the same ConcurrentInfoSetTable (hogwild), so results depend on
+ * thread scheduling. Opponent nodes add their current strategy to the
+ * cumulative strategy with weight 1, which averages it over samples.
+ */
+template <InfoSetKey Key>
+class HogwildMCCFR {
+public:
+    HogwildMCCFR(
+        shared_ptr<const GameNode> root_node,
+        // info sets the table can hold, it does not grow
+        size_t infoset_capacity = 1 << 20,
+        uint64_t seed = 0
+    );
+
+    // runs n_iterations spread over n_threads, 0 uses all hardware threads
+    void train(int n_iterations, int n_threads = 0);
+
+    int getIterationCount() const;
+    int getPlayerCount() const;
+    const ConcurrentInfoSetTable<Key>& getTable() const;
+    // snapshot of the table as InfoSets, must not run concurrently with train
+    InfoSetMap<Key> getStrategyInfoSets() const;
+
+private:
+    // sampled counterfactual value of the traverser
+    double traverse(
+        const shared_ptr<const GameNode>& node,
+        int traverser,
+        cpp_utils::CounterRng& rng
+    );
+
+    shared_ptr<const GameNode> root_node_;
+    ConcurrentInfoSetTable<Key> table_;
+    uint64_t seed_;
+    int n_players_;
+    int n_iterations_;
+};
+
+// Explicit instantiation declarations
+extern template class HogwildMCCFR<string>;
+extern template class HogwildMCCFR<size_t>;
+
+using HogwildMCCFRString = HogwildMCCFR<string>;
+using HogwildMCCFRInt = HogwildMCCFR<size_t>;
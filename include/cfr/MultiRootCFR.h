@@ -0,0 +1,63 @@
+#pragma once
+#include "abstract/nodes/GameNode.h"
+#include "abstract/nodes/MultiRootNode.h"
+#include "abstract/infoset/InfoSetMap.h"
+#include "cfr/CFRPlus.h"
+#include <memory>
+#include <vector>
+
+using namespace std;
+
+/**
+ * @class MultiRootCFR
+ * @brief CFR+ over several weighted root nodes at once.
+ *
+ * The roots become the outcomes of a MultiRootNode and are solved by one
+ * CFRPlus in deterministic parallel mode: every iteration traverses all
+ * roots with the same fixed strategies, the work items of all roots are
+ * spread over the threads and the regrets of shared info sets are reduced
+ * into one map. Besides the weighted value, every iteration reports the
+ * value of each root.
+ */
+template <InfoSetKey Key>
+class MultiRootCFR {
+public:
+    MultiRootCFR(
+        const vector<shared_ptr<const GameNode>>& roots,
+        // relative weights of the roots, normalized to chance probabilities
+        const vector<double>& weights,
+        // 0 = all hardware threads, results are identical for every count
+        int n_threads = 0,
+        // map to train or evaluate in place, see CFRPlus; nullptr starts empty
+        shared_ptr<InfoSetMap<Key>> shared_state = nullptr
+    );
+
+    // one iteration over all roots, returns the value of every root for player 0
+    vector<double> evaluateAndUpdateRegretSum(
+        bool accumulate_regsum = true,
+        bool accumulate_strategy = true
+    );
+    // does not accumulate regrets, returns the value of every root
+    vector<double> evaluateRegretSum();
+
+    size_t getRootCount() const;
+    // weighted mean of the root values of the last iteration
+    double getWeightedValue() const;
+
+    const InfoSetMap<Key>& getStrategyInfoSets();
+    shared_ptr<InfoSetMap<Key>> getSharedInfoSets();
+    // the underlying solver, e.g. for train() with a progress callback
+    CFRPlus<Key>& getSolver();
+
+private:
+    shared_ptr<const MultiRootNode> root_node_;
+    CFRPlus<Key> cfr_;
+    double weighted_value_;
+};
+
+// Explicit instantiation declarations
+extern template class MultiRootCFR<string>;
+extern template class MultiRootCFR<size_t>;
+
+using MultiRootCFRString = MultiRootCFR<string>;
+using MultiRootCFRInt = MultiRootCFR<size_t>;
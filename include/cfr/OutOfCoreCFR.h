@@ -0,0 +1,64 @@
+#pragma once
+#include "abstract/nodes/GameNode.h"
+#include "abstract/infoset/InfoSetMap.h"
+#include "abstract/infoset/InfoSetStore.h"
+#include <memory>
+
+using namespace std;
+
+/**
+ * @class OutOfCoreCFR
+ * @brief CFRPlus with info sets kept in an InfoSetStore instead of an InfoSetMap.
+ *
+ * Performs the same updates in the same order as CFRPlus with default
+ * options and produces identical sums, while only the key index stays on
+ * the heap and the sums are spilled to disk beyond the memory budget.
+ * Info sets are inserted on their first visit, i.e. in the order of the
+ * first traversal, so later traversals read the spill file front to back.
+ */
+template <InfoSetKey Key>
+class OutOfCoreCFR {
+public:
+    OutOfCoreCFR(
+        shared_ptr<const GameNode> root_node,
+        const typename InfoSetStore<Key>::Params& store_params = typename InfoSetStore<Key>::Params(),
+        // may be partial, info sets missing from it start as a new InfoSet;
+        // entries move to the store on their first visit and the rest is
+        // released after the first traversal
+        InfoSetMap<Key> initial_state = InfoSetMap<Key>()
+    );
+
+    // returns game utility at the root node for player 0, see CFRPlus
+    double evaluateAndUpdateRegretSum(
+        bool accumulate_regsum = true,
+        bool accumulate_strategy = true
+    );
+    double evaluateRegretSum();
+
+    typename InfoSetStore<Key>::Statistics getStatistics() const;
+    // materializes all info sets, only for results that fit in memory
+    InfoSetMap<Key> getStrategyInfoSets();
+
+private:
+    // id of the key's record, inserted from the initial state or as a new InfoSet
+    size_t getInfoSetId(const Key& key, size_t n_actions);
+    double processNode(
+        const shared_ptr<const GameNode>& node,
+        double p_past_actions_p0,
+        double p_past_actions_p1,
+        double p_past_chances,
+        bool accumulate_regsum,
+        bool accumulate_strategy
+    );
+
+    shared_ptr<const GameNode> root_node_;
+    InfoSetStore<Key> store_;
+    InfoSetMap<Key> initial_state_;
+};
+
+// Explicit instantiation declarations
+extern template class OutOfCoreCFR<string>;
+extern template class OutOfCoreCFR<size_t>;
+
+using OutOfCoreCFRString = OutOfCoreCFR<string>;
+using OutOfCoreCFRInt = OutOfCoreCFR<size_t>;
@@ -0,0 +1,166 @@
+#pragma once
+#include "abstract/nodes/GameNode.h"
+#include "abstract/infoset/InfoSet.h"
+#include "abstract/infoset/InfoSetMap.h"
+#include <cstddef>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+using namespace std;
+
+/**
+ * @class ShardedCFR
+ * @brief CFR+ trained by several local worker processes over shared memory.
+ *
+ * Info sets are split into shards by key hash, worker w owns shard w: it
+ * computes the shard's strategies and applies its regret and strategy
+ * updates. All sums live in one POSIX shared memory region, so workers have
+ * separate heaps and address spaces while seeing the same table.
+ *
+ * Every iteration the tree is split at a fixed depth into work items, which
+ * are dealt to workers round-robin. A worker writes the weighted regrets of
+ * its items into its exchange buffers, which hold only the info sets its
+ * items reach, one block per owner, and the item values into the region;
+ * the values of the prefix above the items are then completed by worker 0
+ * and every owner reduces the blocks addressed to it in worker order.
+ * Workers only index the keys they reach, the parent keeps the keys for
+ * getStrategyInfoSets. Phases are separated by a process-shared barrier,
+ * errors are reported to the parent through a pipe per worker.
+ *
+ * Strategies are fixed for the whole iteration, as in CFRPlus parallel
+ * iterations, and results are deterministic for a given number of workers.
+ * Linux only: workers are started with fork() for every train() call.
+ * Workers must not run Python code, so the Python bindings reject games
+ * implemented in Python, only native games are supported.
+ */
+template <InfoSetKey Key>
+class ShardedCFR {
+public:
+    ShardedCFR(
+        shared_ptr<const GameNode> root_node,
+        int n_workers,
+        const InfoSetMap<Key>& initial_state = InfoSetMap<Key>()
+    );
+    ~ShardedCFR();
+    ShardedCFR(const ShardedCFR&) = delete;
+    ShardedCFR& operator=(const ShardedCFR&) = delete;
+
+    // runs n_iterations in the worker processes, returns the root value
+    // for player 0 of the last iteration
+    double train(int n_iterations);
+
+    // snapshot of the shared table
+    InfoSetMap<Key> getStrategyInfoSets() const;
+
+    int getWorkerCount() const;
+    size_t getInfoSetCount() const;
+    // info sets owned by the worker
+    size_t getShardSize(int worker) const;
+    size_t getWorkItemCount() const;
+
+private:
+    static constexpr size_t MIN_WORK_ITEMS = 64;
+
+    struct SharedHeader;
+    struct WorkItem {
+        shared_ptr<const GameNode> node;
+        double p_past_actions_p0;
+        double p_past_actions_p1;
+        double p_past_chances;
+    };
+    // info sets reached by a worker and its buffers for their owners
+    struct Exchange {
+        // ascending, so grouped by owner: owner o's entries are
+        // ids[owner_begin[o], owner_begin[o + 1])
+        vector<size_t> ids;
+        vector<size_t> owner_begin;
+        // owner o's block starts at values + value_begin[o] and holds the
+        // regrets followed by the strategies of each of its entries
+        vector<size_t> value_begin;
+        double* values;
+    };
+    // a worker's view of an info set: its strategy and its exchange entry
+    struct Slot {
+        size_t offset;
+        double* contributions;
+    };
+    using WorkerIndex = unordered_map<Key, Slot>;
+
+    void collectInfoSets(
+        const shared_ptr<const GameNode>& node,
+        vector<Key>& keys,
+        vector<size_t>& n_actions,
+        unordered_map<Key, size_t>& seen
+    ) const;
+    // returns the work item nodes
+    vector<shared_ptr<const GameNode>> initWorkDepth();
+    void initExchanges(
+        const unordered_map<Key, size_t>& ids,
+        const vector<shared_ptr<const GameNode>>& items
+    );
+    // marks the info sets from node down to stop_depth
+    void markInfoSets(
+        const shared_ptr<const GameNode>& node,
+        int depth,
+        int stop_depth,
+        const unordered_map<Key, size_t>& ids,
+        vector<bool>& marks
+    ) const;
+    void mapSharedRegion();
+
+    // worker process body, returns an error message or an empty string
+    string runWorker(int worker, int n_iterations);
+    WorkerIndex buildWorkerIndex(int worker) const;
+    void computeShardStrategies(int worker);
+    void reduceShard(int worker, vector<double>& regrets, vector<double>& strategies);
+
+    enum class PrefixPass {
+        None,           // inside a work item
+        CollectItems,   // records nodes at work_depth_ with their reach
+        UseItems        // uses item_values_ in the order the items were recorded
+    };
+    // adds weighted regrets and strategies to the exchange entries
+    double processNode(
+        const shared_ptr<const GameNode>& node,
+        int depth,
+        double p_past_actions_p0,
+        double p_past_actions_p1,
+        double p_past_chances,
+        const WorkerIndex& index,
+        PrefixPass pass,
+        size_t& next_item
+    );
+
+    shared_ptr<const GameNode> root_node_;
+    int n_workers_;
+
+    // dense ids grouped by shard, shard w is [shard_offsets_[w], shard_offsets_[w + 1])
+    vector<Key> infoset_keys_;
+    vector<size_t> shard_offsets_;
+    // actions of id i are [infoset_offsets_[i], infoset_offsets_[i + 1])
+    vector<size_t> infoset_offsets_;
+
+    int work_depth_;
+    // recorded again by every worker in every iteration
+    vector<WorkItem> work_items_;
+    size_t n_work_items_;
+    vector<Exchange> exchanges_;
+
+    // shared region: header, regret sums, strategy sums, current strategies,
+    // item values, then the exchange buffers of every worker
+    void* region_;
+    size_t region_size_;
+    SharedHeader* header_;
+    double* regret_sums_;
+    double* strategy_sums_;
+    double* strategies_;
+    double* item_values_;
+};
+
+// Explicit instantiation declarations
+extern template class ShardedCFR<string>;
+extern template class ShardedCFR<size_t>;
+
+using ShardedCFRString = ShardedCFR<string>;
+using ShardedCFRInt = ShardedCFR<size_t>;
@@ -0,0 +1,106 @@
+#pragma once
+#include "abstract/nodes/PublicTreeNode.h"
+#include "abstract/infoset/InfoSet.h"
+#include "abstract/infoset/InfoSetMap.h"
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+using namespace std;
+
+/**
+ * @class VectorCFR
+ * @brief CFR+ over the public tree with reach probability vectors.
+ *
+ * One traversal of the public tree replaces the traversals of all private
+ * state pairs: every public node receives the reach vectors of both players
+ * and returns the counterfactual values of both players, one entry per
+ * private state. Terminal nodes hold prior-weighted utility matrices, so
+ * their values are two dense matrix-vector products; equal matrices are
+ * stored once.
+ *
+ * Info sets are the same InfoSet objects and keys as in CFRPlus, so the
+ * result can be used wherever a CFRPlus map is expected. Regrets of an
+ * info set are accumulated once per iteration with the regret summed over
+ * all of its histories, which is the textbook CFR+ update; CFRPlus updates
+ * after every history, so the iterates differ slightly between the two.
+ */
+template <InfoSetKey Key>
+class VectorCFR {
+public:
+    VectorCFR(
+        shared_ptr<const PublicTreeNode> root,
+        const InfoSetMap<Key>& initial_state = InfoSetMap<Key>()
+    );
+    // nodes point into infosets_, moving keeps the pointers valid
+    VectorCFR(const VectorCFR&) = delete;
+    VectorCFR(VectorCFR&&) = default;
+
+    // returns game utility at the root node for player 0
+    // if playing regretsum-based strategy, see CFRPlus
+    double evaluateAndUpdateRegretSum(
+        bool accumulate_regsum = true,
+        bool accumulate_strategy = true
+    );
+    double evaluateRegretSum();
+
+    const InfoSetMap<Key>& getStrategyInfoSets() const;
+
+    size_t getPublicNodeCount() const;
+    // unique terminal utility matrices
+    size_t getTerminalMatrixCount() const;
+
+private:
+    size_t addNode(const shared_ptr<const PublicTreeNode>& node);
+    size_t addTerminalMatrices(const shared_ptr<const PublicTreeNode>& node);
+
+    // writes counterfactual values of both players for every private state,
+    // values include the prior and the opponent's reach but not the own reach
+    void processNode(
+        size_t node,
+        const double* const reach[2],
+        double* const cfv[2],
+        bool accumulate_regsum,
+        bool accumulate_strategy
+    );
+    void processDecisionNode(
+        size_t node,
+        const double* const reach[2],
+        double* const cfv[2],
+        bool accumulate_regsum,
+        bool accumulate_strategy
+    );
+    void processTerminalNode(
+        size_t node,
+        const double* const reach[2],
+        double* const cfv[2]
+    ) const;
+
+    size_t n_states_[2];
+    InfoSetMap<Key> infosets_;
+
+    // nodes in preorder
+    vector<GameNode::Type> node_type_;
+    vector<int> node_player_;
+    // offset into node_infosets_ for decision nodes, matrix id for terminal nodes
+    vector<size_t> node_slot_;
+    // children of node i are [node_first_edge_[i], node_first_edge_[i + 1])
+    vector<size_t> node_first_edge_;
+    vector<size_t> edge_child_;
+    // info set of every private state of the acting player
+    vector<InfoSet*> node_infosets_;
+
+    // utility matrices of players 0 and 1 multiplied by the prior,
+    // matrix id m occupies [2 * m * n_pairs, 2 * (m + 1) * n_pairs)
+    vector<double> terminal_matrices_;
+    // content hash -> matrix ids, only used during construction
+    unordered_multimap<uint64_t, size_t> matrix_ids_;
+};
+
+// Explicit instantiation declarations
+extern template class VectorCFR<string>;
+extern template class VectorCFR<size_t>;
+
+using VectorCFRString = VectorCFR<string>;
+using VectorCFRInt = VectorCFR<size_t>;
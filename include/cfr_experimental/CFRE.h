@@ -2,6 +2,7 @@
 #include "abstract/nodes/GameNode.h"
 #include "abstract/infoset/InfoSet.h"
 #include "abstract/infoset/InfoSetMap.h"
+#include "abstract/infoset/InfoSetUtils.h"
 #include <unordered_map>
 #include <memory>
 #include <vector>
@@ -16,7 +17,12 @@ public:
         int n_players,
         bool initial_evaluation_run = true,
         double e_soft_regsum_strategies = 0,
-        const InfoSetMap<ISKey>& initial_state = InfoSetMap<ISKey>()
+        // may be partial: missing info sets are added on their first visit,
+        // an info set with a different number of actions than its node throws
+        const InfoSetMap<ISKey>& initial_state = InfoSetMap<ISKey>(),
+        // info sets are created on their first visit,
+        // the hint reserves the map to avoid rehashing while it grows
+        size_t infoset_capacity_hint = 0
     );
 
     // returns game utilities at the root node for all players
@@ -68,9 +74,6 @@ private:
         const shared_ptr<const GameNode> node
     );
 
-    void initInfoStates();
-    void initInfoStatesRecursively(const shared_ptr<const GameNode> node);
-    
     const shared_ptr<const GameNode> root_node_;
     InfoSetMap<ISKey> infosets_;
     double e_soft_regsum_strategies_;
@@ -0,0 +1,94 @@
+#pragma once
+
+#include "abstract/nodes/GameNode.h"
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+/**
+ * @class GoofspielNode
+ * @brief Two-player Goofspiel with hidden simultaneous bids.
+ *
+ * Each player holds cards 1..n_cards, and a prize deck with the same values
+ * is revealed one card per round (chance node for random order). Both players
+ * then bid one of their remaining cards; the simultaneous bid is modelled as
+ * player 0 deciding first and player 1 deciding without seeing that bid.
+ * After both bids only the round outcome (who won the prize) is revealed.
+ *
+ * With random prize order the number of info sets grows steeply with n_cards:
+ * 426 at n_cards = 3, 17k at 4, 1.2M at 5 and on the order of 10^8 at 6.
+ *
+ * Info-set keys are exact 64-bit mixed-radix encodings of the player's view
+ * (prize ranks, own bid ranks, round outcomes), so there are no collisions.
+ * This limits n_cards to MAX_CARDS.
+ */
+class GoofspielNode : public GameNode {
+public:
+    static constexpr int MAX_CARDS = 10;
+
+    enum class PrizeOrder { Random, Ascending, Descending };
+
+    struct Params {
+        int n_cards = 4;
+        PrizeOrder prize_order = PrizeOrder::Random;
+        // +1/-1/0 for win/loss/draw if true, otherwise difference in points
+        bool win_loss_utility = true;
+    };
+
+    GoofspielNode();
+    GoofspielNode(const Params& params);
+
+    Type getType() const override;
+
+    const vector<double>& getTerminalUtilities() const override;
+    const vector<double>& getChanceProbabilities() const override;
+
+    const vector<int>& getLegalActions() const override;
+    shared_ptr<const GameNode> applyAction(int action) const override;
+
+    int getCurrentPlayer() const override;
+    string getInfoSetKeyString() const override;
+    size_t getInfoSetKeyInt() const override;
+
+    string toString() const override;
+    string actionToString(int action) const override;
+
+    const Params& getParams() const;
+    int getRound() const;
+    const array<int, 2>& getPoints() const;
+
+private:
+    enum class Phase { PrizeReveal, Bid0, Bid1, Finished };
+
+    GoofspielNode(shared_ptr<const Params> params);
+
+    void revealPrize(int prize);
+    void placeBid(int player, int card);
+    void resolveRound();
+    void calculateProperties();
+
+    int prizeForFixedOrder() const;
+    static int rank(uint32_t remaining, int card);
+
+    shared_ptr<const Params> params_;
+
+    Phase phase_;
+    int round_;
+    array<int, 2> points_;
+    // bitmasks of cards not yet used, bit i stands for card value i + 1
+    uint32_t remaining_prizes_;
+    array<uint32_t, 2> remaining_bids_;
+    // history, indexed by round
+    array<int, MAX_CARDS> prizes_;
+    array<array<int, MAX_CARDS>, 2> bids_;
+    // mixed-radix encoding of each player's observations so far
+    array<uint64_t, 2> encoded_view_;
+
+    vector<int> legal_actions_;
+    vector<double> chance_probabilities_;
+    vector<double> utilities_;
+};
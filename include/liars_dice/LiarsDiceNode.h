@@ -0,0 +1,97 @@
+#pragma once
+
+#include "abstract/nodes/GameNode.h"
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+/**
+ * @class LiarsDiceNode
+ * @brief Two-player Liar's Dice with a single dice-roll chance root.
+ *
+ * The root chance node deals both hands at once: every pair of sorted rolls
+ * (multisets of faces) is one outcome, weighted by its multinomial
+ * probability. With 2 dice of 6 faces per player that is 21 * 21 = 441
+ * outcomes, which makes the root a stress test for chance node handling.
+ *
+ * A bid is (quantity, face) and is encoded as (quantity - 1) * n_faces + face - 1.
+ * Bids must strictly increase in this encoding, and the extra action n_bids
+ * calls the previous bid a lie. With highest_face_wild the highest face counts
+ * towards any other face.
+ *
+ * Since bids strictly increase, the whole bid history is the set of bids made,
+ * and the acting player is its size parity. The info-set key is therefore the
+ * bid bitmask combined with the index of the player's own roll, an O(1) key
+ * without string building.
+ */
+class LiarsDiceNode : public GameNode {
+public:
+    struct Params {
+        int dice_per_player = 1;
+        int n_faces = 6;
+        bool highest_face_wild = true;
+    };
+
+    LiarsDiceNode();
+    LiarsDiceNode(const Params& params);
+
+    Type getType() const override;
+
+    const vector<double>& getTerminalUtilities() const override;
+    const vector<double>& getChanceProbabilities() const override;
+
+    const vector<int>& getLegalActions() const override;
+    shared_ptr<const GameNode> applyAction(int action) const override;
+
+    int getCurrentPlayer() const override;
+    string getInfoSetKeyString() const override;
+    size_t getInfoSetKeyInt() const override;
+
+    string toString() const override;
+    string actionToString(int action) const override;
+
+    const Params& getParams() const;
+    int getNumBids() const;
+    int getLiarAction() const;
+    // sorted rolls of one player, deal outcome roll_0 * getRollCount() + roll_1
+    int getRollCount() const;
+    const vector<double>& getDealProbabilities() const;
+    // -1 before the first bid
+    int getLastBid() const;
+    // node after the same bids with the given rolls, a deal node becomes the
+    // first bidding node; throws logic_error for a finished game
+    LiarsDiceNode withRolls(int roll_0, int roll_1) const;
+
+private:
+    // data shared by all nodes of one game
+    struct Tables {
+        Params params;
+        int n_bids;
+        int roll_bits;
+        // face counts of every sorted roll of one player
+        vector<vector<int>> roll_face_counts;
+        vector<int> root_actions;
+        vector<double> root_probabilities;
+    };
+
+    enum class Phase { Deal, Bidding, Finished };
+
+    static shared_ptr<const Tables> buildTables(const Params& params);
+
+    string bidToString(int bid) const;
+    string rollToString(int roll_idx) const;
+    void calculateProperties();
+
+    shared_ptr<const Tables> tables_;
+
+    Phase phase_;
+    int rolls_[2];
+    uint64_t bid_mask_;
+    int last_bid_;
+
+    vector<int> legal_actions_;
+    vector<double> utilities_;
+};
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "abstract/nodes/PublicTreeNode.h"
+#include "liars_dice/LiarsDiceNode.h"
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+/**
+ * @class LiarsDicePublicNode
+ * @brief Public tree of Liar's Dice for vector-form solvers.
+ *
+ * Private states are the sorted rolls of a player, the prior is the deal of
+ * the LiarsDiceNode chance root. A node wraps the LiarsDiceNode after the
+ * same bids, so info-set keys and terminal utilities are computed by
+ * LiarsDiceNode itself and match it exactly.
+ */
+class LiarsDicePublicNode : public PublicTreeNode {
+public:
+    LiarsDicePublicNode();
+    LiarsDicePublicNode(const LiarsDiceNode::Params& params);
+
+    GameNode::Type getType() const override;
+
+    size_t getPrivateStateCount(int player) const override;
+    const vector<double>& getPrivateStatePrior() const override;
+
+    vector<double> getTerminalUtilityMatrix(int player) const override;
+
+    int getCurrentPlayer() const override;
+    const vector<int>& getLegalActions() const override;
+    shared_ptr<const PublicTreeNode> applyAction(int action) const override;
+    string getInfoSetKeyString(size_t private_state) const override;
+    size_t getInfoSetKeyInt(size_t private_state) const override;
+
+private:
+    LiarsDicePublicNode(const LiarsDiceNode& bidding_node, bool liar_called);
+    // node_ with the acting player's roll set to private_state
+    LiarsDiceNode withOwnRoll(size_t private_state) const;
+
+    // bidding node with placeholder rolls, the last bidding node for a terminal
+    LiarsDiceNode node_;
+    bool liar_called_;
+};
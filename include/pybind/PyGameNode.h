@@ -22,6 +22,10 @@ public:
     int getCurrentPlayer() const override;
     string getInfoSetKeyString() const override;
     size_t getInfoSetKeyInt() const override;
+
+    // Optional state hash
+    bool hasStateHash() const override;
+    uint64_t getStateHash() const override;
     
     virtual ~PyGameNode() = default;
 };
\ No newline at end of file
@@ -0,0 +1,87 @@
+#pragma once
+
+#include "abstract/nodes/GameNode.h"
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+/**
+ * @class SyntheticGameNode
+ * @brief Seeded random game tree for solver scaling studies.
+ *
+ * Every property of a node (type, acting player, number of actions, chance
+ * probabilities, utilities) is derived from a hash of the seed and the action
+ * path leading to it, so the tree is fully deterministic for a given seed and
+ * nothing besides the current node is ever held in memory.
+ *
+ * Info sets are formed by aliasing: decision nodes of the same player at the
+ * same depth are bucketed into infosets_per_depth groups by path hash.
+ * The number of actions is a function of the info set, so all nodes that share
+ * an info set agree on it. Perfect recall is not guaranteed, which is fine
+ * for measuring traversal cost but should be kept in mind when reading values.
+ */
+class SyntheticGameNode : public GameNode {
+public:
+    struct Params {
+        uint64_t seed = 1;
+        int n_players = 2;
+        // every path ends exactly at this depth unless terminated early
+        int max_depth = 6;
+        // number of actions of a decision node is drawn from [min_actions, max_actions]
+        int min_actions = 2;
+        int max_actions = 3;
+        // probability that a non-terminal node is a chance node
+        double chance_node_probability = 0.2;
+        int n_chance_outcomes = 3;
+        // probability that a node above max_depth is terminal
+        double terminal_probability = 0.0;
+        // number of info sets per (depth, player), 0 means every history is its own info set
+        size_t infosets_per_depth = 0;
+        // if true, utilities of all players sum to zero
+        bool zero_sum = true;
+    };
+
+    SyntheticGameNode();
+    SyntheticGameNode(const Params& params);
+
+    Type getType() const override;
+
+    const vector<double>& getTerminalUtilities() const override;
+    const vector<double>& getChanceProbabilities() const override;
+
+    const vector<int>& getLegalActions() const override;
+    shared_ptr<const GameNode> applyAction(int action) const override;
+
+    int getCurrentPlayer() const override;
+    string getInfoSetKeyString() const override;
+    size_t getInfoSetKeyInt() const override;
+
+    string toString() const override;
+
+    const Params& getParams() const;
+    int getDepth() const;
+    uint64_t getPathHash() const;
+
+private:
+    SyntheticGameNode(
+        shared_ptr<const Params> params,
+        int depth,
+        uint64_t path_hash
+    );
+
+    void calculateProperties();
+
+    shared_ptr<const Params> params_;
+    int depth_;
+    uint64_t path_hash_;
+
+    Type type_;
+    int current_player_;
+    size_t infoset_key_;
+    vector<int> legal_actions_;
+    vector<double> chance_probabilities_;
+    vector<double> utilities_;
+};
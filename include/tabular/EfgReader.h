@@ -0,0 +1,28 @@
+#pragma once
+
+#include "tabular/TabularGame.h"
+#include <istream>
+#include <memory>
+#include <string>
+
+using namespace std;
+
+/**
+ * @class EfgReader
+ * @brief Reads games in the Gambit extensive-form (.efg) text format.
+ *
+ * Supports the "EFG 2 R" and "EFG 2 D" formats with terminal ("t"),
+ * chance ("c") and personal ("p") nodes in preorder, rational or decimal
+ * chance probabilities and payoffs, and outcomes attached to non-terminal
+ * nodes (their payoffs are added to every terminal below).
+ *
+ * Players are renumbered from 0. Decision info-set keys are
+ * "<player>:<infoset number>" as strings and the dense info-set index as
+ * integers, so both key types are collision free.
+ */
+class EfgReader {
+public:
+    static shared_ptr<const TabularGame> readFile(const string& filename);
+    static shared_ptr<const TabularGame> readString(const string& content);
+    static shared_ptr<const TabularGame> read(istream& input);
+};
@@ -0,0 +1,157 @@
+#pragma once
+
+#include "abstract/nodes/GameNode.h"
+#include <map>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+using namespace std;
+
+class TabularGame;
+
+/**
+ * @class TabularGameNode
+ * @brief GameNode view of one node of a TabularGame.
+ *
+ * Nodes are preallocated by the game, applyAction is an index lookup
+ * that returns a pointer sharing ownership of the whole game.
+ */
+class TabularGameNode : public GameNode {
+    friend class TabularGame;
+
+public:
+    Type getType() const override;
+
+    const vector<double>& getTerminalUtilities() const override;
+    const vector<double>& getChanceProbabilities() const override;
+
+    const vector<int>& getLegalActions() const override;
+    shared_ptr<const GameNode> applyAction(int action) const override;
+
+    int getCurrentPlayer() const override;
+    string getInfoSetKeyString() const override;
+    size_t getInfoSetKeyInt() const override;
+
+    string toString() const override;
+    string actionToString(int action) const override;
+
+    size_t getIndex() const;
+    const TabularGame& getGame() const;
+
+private:
+    TabularGameNode(const TabularGame* game, size_t index);
+
+    size_t actionIndex(int action) const;
+
+    const TabularGame* game_;
+    size_t index_;
+};
+
+
+/**
+ * @class TabularGame
+ * @brief Game tree stored in flat arrays.
+ *
+ * Every node is a type, a slot and a first-edge offset. The slot indexes
+ * the payoff table for terminal nodes, the chance table for chance nodes and
+ * the info set table for decision nodes. Children are stored contiguously
+ * per node in the edge array, one per legal action.
+ * Action lists, payoff vectors and chance distributions are deduplicated.
+ *
+ * Games are assembled with TabularGame::Builder, either by a file reader
+ * (see EfgReader) or by freezing an existing GameNode tree.
+ */
+class TabularGame : public enable_shared_from_this<TabularGame> {
+    friend class TabularGameNode;
+
+public:
+    class Builder {
+    public:
+        Builder(int n_players);
+
+        // info sets must be added before the decision nodes that use them
+        size_t addInfoSet(
+            int player,
+            const string& key_string,
+            size_t key_int,
+            const vector<int>& actions,
+            const vector<string>& action_names = {}
+        );
+
+        size_t addTerminalNode(const vector<double>& utilities);
+        size_t addChanceNode(
+            const vector<int>& actions,
+            const vector<double>& probabilities,
+            const vector<string>& action_names = {}
+        );
+        size_t addDecisionNode(size_t infoset_id);
+
+        // action_idx is the position of the action in the node's legal actions
+        void setChild(size_t parent, size_t action_idx, size_t child);
+        void setRoot(size_t root);
+
+        size_t getNodeCount() const;
+        size_t getInfoSetCount() const;
+
+        shared_ptr<const TabularGame> build();
+
+    private:
+        int addActionList(const vector<int>& actions);
+        // the game under construction, throws logic_error after build()
+        TabularGame& getGame() const;
+
+        shared_ptr<TabularGame> game_;
+        map<vector<int>, int> action_list_ids_;
+        map<vector<double>, int> payoff_ids_;
+        map<tuple<int, vector<double>, vector<string>>, int> chance_ids_;
+    };
+
+    shared_ptr<const GameNode> getRootNode() const;
+    shared_ptr<const GameNode> getNode(size_t index) const;
+
+    int getPlayerCount() const;
+    size_t getNodeCount() const;
+    size_t getInfoSetCount() const;
+
+    static constexpr size_t NO_CHILD = SIZE_MAX;
+
+private:
+    struct InfoSetEntry {
+        int player;
+        int action_list;
+        string key_string;
+        size_t key_int;
+        vector<string> action_names;
+    };
+
+    struct ChanceEntry {
+        int action_list;
+        vector<double> probabilities;
+        vector<string> action_names;
+    };
+
+    TabularGame(int n_players);
+
+    size_t addNode(GameNode::Type type, int slot, size_t n_actions);
+    const vector<int>& getActionList(size_t node) const;
+
+    int n_players_;
+    size_t root_;
+
+    // per node
+    vector<GameNode::Type> node_type_;
+    vector<int> node_slot_;
+    vector<size_t> node_first_edge_;
+
+    // per edge
+    vector<size_t> edge_child_;
+
+    vector<vector<int>> action_lists_;
+    vector<vector<double>> payoffs_;
+    vector<ChanceEntry> chance_entries_;
+    vector<InfoSetEntry> infosets_;
+
+    vector<TabularGameNode> nodes_;
+};
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "tabular/TabularGame.h"
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace std;
+
+/**
+ * @class Tabularizer
+ * @brief Freezes any GameNode tree into a TabularGame.
+ *
+ * The source tree is walked once, depth first. Every node is queried once for
+ * its type, actions, probabilities, utilities and info-set keys, after which
+ * the tabular copy can be traversed without touching the source game. This is
+ * meant for games implemented in Python, where each GameNode call goes through
+ * the interpreter.
+ *
+ * Info sets are identified by their string key (or the integer key when the
+ * string key is not implemented) and keep both original keys, so strategies
+ * trained on the tabular copy apply to the original game.
+ * Transpositions are not merged - the result is a tree.
+ */
+class Tabularizer {
+public:
+    // n_players = -1 takes the number of players from the first terminal node
+    static shared_ptr<const TabularGame> tabularize(
+        shared_ptr<const GameNode> root,
+        int n_players = -1
+    );
+
+private:
+    Tabularizer(int n_players);
+
+    static int countPlayers(shared_ptr<const GameNode> root);
+
+    size_t addNode(const shared_ptr<const GameNode>& node);
+    size_t getInfoSet(const shared_ptr<const GameNode>& node);
+
+    struct InfoSetRecord {
+        size_t id;
+        int player;
+        vector<int> actions;
+    };
+
+    TabularGame::Builder builder_;
+    unordered_map<string, InfoSetRecord> infosets_;
+};
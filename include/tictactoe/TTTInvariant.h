@@ -26,6 +26,10 @@ public:
     
     string getInfoSetKeyString() const override;
     size_t getInfoSetKeyInt() const override;
+
+    // the board determines the whole subtree
+    bool hasStateHash() const override;
+    uint64_t getStateHash() const override;
 private:
     TicTacToeNode internal_ttt_node_;
     vector<int> legal_invariant_actions_;
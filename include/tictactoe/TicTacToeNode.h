@@ -23,6 +23,10 @@ public:
     shared_ptr<const GameNode> applyAction(int action) const override;
     string getInfoSetKeyString() const override;
     size_t getInfoSetKeyInt() const override;
+
+    // the board determines the whole subtree
+    bool hasStateHash() const override;
+    uint64_t getStateHash() const override;
     
     string getBoardString() const;
     const TicTacToeBoard& getBoard() const;
@@ -1,6 +1,13 @@
 #include "Utils.h"
 #include <cxxabi.h>
 #include <cstdlib>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
 
 
 string cpp_utils::demangle(const char* mangled) {
@@ -12,16 +19,140 @@ string cpp_utils::demangle(const char* mangled) {
 }
 
 
+uint64_t cpp_utils::mixHash(uint64_t value) {
+    value += 0x9e3779b97f4a7c15ULL;
+    value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    value = (value ^ (value >> 27)) * 0x94d049bb133111ebULL;
+    return value ^ (value >> 31);
+}
+
+uint64_t cpp_utils::hashCombine(uint64_t seed, uint64_t value) {
+    return mixHash(seed ^ mixHash(value));
+}
+
+double cpp_utils::hashToUnit(uint64_t hash) {
+    // top 53 bits fill the double mantissa exactly
+    return (hash >> 11) * 0x1.0p-53;
+}
+
+void cpp_utils::parallelFor(size_t n, int n_threads, const function<void(size_t)>& fn) {
+    if (n_threads <= 0) {
+        n_threads = max(1u, thread::hardware_concurrency());
+    }
+    n_threads = min<size_t>(n_threads, max<size_t>(n, 1));
+
+    atomic<size_t> next = 0;
+    exception_ptr error;
+    mutex error_mutex;
+
+    auto worker = [&]() {
+        try {
+            size_t i;
+            while ((i = next++) < n) {
+                fn(i);
+            }
+        } catch (...) {
+            lock_guard<mutex> lock(error_mutex);
+            if (!error) {
+                error = current_exception();
+            }
+            // stop handing out work
+            next = n;
+        }
+    };
+
+    vector<thread> threads;
+    for (int t = 1; t < n_threads; t++) {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for (thread& t : threads) {
+        t.join();
+    }
+    if (error) {
+        rethrow_exception(error);
+    }
+}
+
+
+size_t cpp_utils::sampleIndex(span<const double> probabilities, double u) {
+    for (size_t i = 0; i + 1 < probabilities.size(); i++) {
+        u -= probabilities[i];
+        if (u < 0) {
+            return i;
+        }
+    }
+    return probabilities.size() - 1;
+}
+
+cpp_utils::SampleStatistics cpp_utils::sampleInChunks(
+    size_t n_samples, size_t chunk_size, int n_threads,
+    const function<vector<double>(size_t)>& sample
+) {
+    size_t n_chunks = (n_samples + chunk_size - 1) / chunk_size;
+
+    // per chunk: sums of values and of their squares
+    vector<vector<double>> chunk_sums(n_chunks);
+    vector<vector<double>> chunk_square_sums(n_chunks);
+
+    parallelFor(n_chunks, n_threads, [&](size_t chunk) {
+        size_t end = min(n_samples, (chunk + 1) * chunk_size);
+        for (size_t i = chunk * chunk_size; i < end; i++) {
+            vector<double> values = sample(i);
+            if (chunk_sums[chunk].empty()) {
+                chunk_sums[chunk].assign(values.size(), 0.0);
+                chunk_square_sums[chunk].assign(values.size(), 0.0);
+            }
+            for (size_t v = 0; v < values.size(); v++) {
+                chunk_sums[chunk][v] += values[v];
+                chunk_square_sums[chunk][v] += values[v] * values[v];
+            }
+        }
+    });
+
+    // reduce in chunk order for thread count independent results
+    vector<double> sums;
+    vector<double> square_sums;
+    for (size_t chunk = 0; chunk < n_chunks; chunk++) {
+        if (sums.empty()) {
+            sums.assign(chunk_sums[chunk].size(), 0.0);
+            square_sums.assign(chunk_sums[chunk].size(), 0.0);
+        }
+        for (size_t v = 0; v < sums.size(); v++) {
+            sums[v] += chunk_sums[chunk][v];
+            square_sums[v] += chunk_square_sums[chunk][v];
+        }
+    }
+
+    SampleStatistics statistics;
+    for (size_t v = 0; v < sums.size(); v++) {
+        double mean = sums[v] / n_samples;
+        double variance = n_samples > 1 ?
+            max(0.0, (square_sums[v] - n_samples * mean * mean) / (n_samples - 1)) : 0.0;
+        double standard_error = sqrt(variance / n_samples);
+        statistics.means.push_back(mean);
+        statistics.standard_errors.push_back(standard_error);
+        statistics.confidence_95.push_back(1.96 * standard_error);
+    }
+    return statistics;
+}
+
+
 // Static helper function to normalize strategies
 vector<double> strategy_utils::normalizeStrategy(const vector<double>& strategy) {
-    vector<double> normalized = strategy;
+    vector<double> normalized(strategy.size());
+    normalizeStrategyInto(strategy, normalized);
+    return normalized;
+}
 
-    for (size_t i = 0; i < normalized.size(); i++) {
-        normalized[i] = max(0.0, normalized[i]);
+void strategy_utils::normalizeStrategyInto(span<const double> strategy, span<double> normalized) {
+    if (normalized.size() != strategy.size()) {
+        throw invalid_argument("Normalized strategy buffer does not match the strategy");
     }
 
     double sum = 0.0;
-    for (size_t i = 0; i < normalized.size(); i++) {
+    for (size_t i = 0; i < strategy.size(); i++) {
+        normalized[i] = max(0.0, strategy[i]);
         sum += normalized[i];
     }
     
@@ -35,8 +166,6 @@ vector<double> strategy_utils::normalizeStrategy(const vector<double>& strategy)
         double uniformProb = 1.0 / normalized.size();
         std::fill(normalized.begin(), normalized.end(), uniformProb);
     }
-    
-    return normalized;
 }
 
 
@@ -56,3 +185,37 @@ vector<double> strategy_utils::epsilonSoftStrategy(
     
     return softened_strategy;
 }
+
+
+cfr_utils::UpdateWeights cfr_utils::getUpdateWeights(
+    int player, double p_past_actions_p0, double p_past_actions_p1, double p_past_chances
+) {
+    if (player == 0) {
+        return {p_past_chances * p_past_actions_p1, p_past_actions_p0};
+    }
+    return {p_past_chances * p_past_actions_p0, p_past_actions_p1};
+}
+
+void cfr_utils::computeInstantRegrets(
+    int player, span<const double> action_values, double value, span<double> instant_regrets
+) {
+    for (size_t action_idx = 0; action_idx < action_values.size(); action_idx++) {
+        double regret = action_values[action_idx] - value;
+        // values are for player 0
+        instant_regrets[action_idx] = player == 1 ? -regret : regret;
+    }
+}
+
+void cfr_utils::accumulateWeighted(span<double> sums, double weight, span<const double> values) {
+    for (size_t i = 0; i < sums.size(); i++) {
+        sums[i] += weight * values[i];
+    }
+}
+
+void cfr_utils::accumulatePositiveRegret(
+    span<double> regret_sum, double weight, span<const double> instant_regrets
+) {
+    for (size_t i = 0; i < regret_sum.size(); i++) {
+        regret_sum[i] = max(0.0, regret_sum[i] + weight * instant_regrets[i]);
+    }
+}
@@ -0,0 +1,194 @@
+#include "abstract/infoset/ConcurrentInfoSetTable.h"
+#include "abstract/infoset/InfoSet.h"
+#include "Utils.h"
+#include <algorithm>
+#include <bit>
+#include <functional>
+#include <stdexcept>
+
+
+template <InfoSetKey Key>
+ConcurrentInfoSetTable<Key>::Entry::Entry(const Key& key, size_t n_actions)
+    : key_(key),
+    n_actions_(n_actions),
+    sums_(new atomic<double>[2 * n_actions])
+{
+    // same initial sums as a new InfoSet, so exported maps warm-start other solvers alike
+    for (size_t i = 0; i < 2 * n_actions; i++) {
+        sums_[i].store(i < n_actions ? InfoSet::INITIAL_REGRET_SUM : 0.0, memory_order_relaxed);
+    }
+}
+
+template <InfoSetKey Key>
+const Key& ConcurrentInfoSetTable<Key>::Entry::getKey() const {
+    return key_;
+}
+
+template <InfoSetKey Key>
+size_t ConcurrentInfoSetTable<Key>::Entry::getActionCount() const {
+    return n_actions_;
+}
+
+template <InfoSetKey Key>
+void ConcurrentInfoSetTable<Key>::Entry::getRegretSumStrategy(span<double> strategy) const {
+    if (strategy.size() != n_actions_) {
+        throw invalid_argument("Strategy buffer does not match the number of actions");
+    }
+    for (size_t i = 0; i < n_actions_; i++) {
+        // every action is read once, normalizing the copies keeps the result consistent
+        strategy[i] = sums_[i].load(memory_order_relaxed);
+    }
+    strategy_utils::normalizeStrategyInto(strategy, strategy);
+}
+
+template <InfoSetKey Key>
+void ConcurrentInfoSetTable<Key>::Entry::accumulateRegret(
+    double weight, span<const double> instant_regret
+) {
+    if (instant_regret.size() != n_actions_) {
+        throw invalid_argument("Instant regret does not match the number of actions");
+    }
+    for (size_t i = 0; i < n_actions_; i++) {
+        double delta = weight * instant_regret[i];
+        double old_value = sums_[i].load(memory_order_relaxed);
+        // retries only when another thread updated the same action in between
+        while (!sums_[i].compare_exchange_weak(
+            old_value, max(0.0, old_value + delta), memory_order_relaxed
+        )) { }
+    }
+}
+
+template <InfoSetKey Key>
+void ConcurrentInfoSetTable<Key>::Entry::accumulateStrategy(
+    double weight, span<const double> strategy
+) {
+    if (strategy.size() != n_actions_) {
+        throw invalid_argument("Strategy does not match the number of actions");
+    }
+    for (size_t i = 0; i < n_actions_; i++) {
+        sums_[n_actions_ + i].fetch_add(weight * strategy[i], memory_order_relaxed);
+    }
+}
+
+template <InfoSetKey Key>
+vector<double> ConcurrentInfoSetTable<Key>::Entry::getRegretSum() const {
+    vector<double> values(n_actions_);
+    for (size_t i = 0; i < n_actions_; i++) {
+        values[i] = sums_[i].load(memory_order_relaxed);
+    }
+    return values;
+}
+
+template <InfoSetKey Key>
+vector<double> ConcurrentInfoSetTable<Key>::Entry::getCumulativeStrategySum() const {
+    vector<double> values(n_actions_);
+    for (size_t i = 0; i < n_actions_; i++) {
+        values[i] = sums_[n_actions_ + i].load(memory_order_relaxed);
+    }
+    return values;
+}
+
+
+template <InfoSetKey Key>
+ConcurrentInfoSetTable<Key>::ConcurrentInfoSetTable(size_t capacity)
+    : mask_(bit_ceil(max<size_t>(capacity, 1)) - 1),
+    slots_(new atomic<Entry*>[mask_ + 1]),
+    size_(0)
+{
+    for (size_t slot = 0; slot <= mask_; slot++) {
+        slots_[slot].store(nullptr, memory_order_relaxed);
+    }
+}
+
+template <InfoSetKey Key>
+ConcurrentInfoSetTable<Key>::~ConcurrentInfoSetTable() {
+    for (size_t slot = 0; slot <= mask_; slot++) {
+        delete slots_[slot].load(memory_order_relaxed);
+    }
+}
+
+template <InfoSetKey Key>
+size_t ConcurrentInfoSetTable<Key>::getHomeSlot(const Key& key) const {
+    return cpp_utils::mixHash(hash<Key>{}(key)) & mask_;
+}
+
+template <InfoSetKey Key>
+typename ConcurrentInfoSetTable<Key>::Entry* ConcurrentInfoSetTable<Key>::find(
+    const Key& key
+) const {
+    size_t slot = getHomeSlot(key);
+    for (size_t probe = 0; probe <= mask_; probe++) {
+        Entry* entry = slots_[slot].load(memory_order_acquire);
+        if (entry == nullptr) {
+            return nullptr;
+        }
+        if (entry->getKey() == key) {
+            return entry;
+        }
+        slot = (slot + 1) & mask_;
+    }
+    return nullptr;
+}
+
+template <InfoSetKey Key>
+typename ConcurrentInfoSetTable<Key>::Entry& ConcurrentInfoSetTable<Key>::findOrInsert(
+    const Key& key, size_t n_actions
+) {
+    unique_ptr<Entry> new_entry;
+    size_t slot = getHomeSlot(key);
+    for (size_t probe = 0; probe <= mask_; probe++) {
+        Entry* entry = slots_[slot].load(memory_order_acquire);
+        if (entry == nullptr) {
+            if (!new_entry) {
+                new_entry = make_unique<Entry>(key, n_actions);
+            }
+            // release publishes the initialized entry to readers of the slot
+            if (slots_[slot].compare_exchange_strong(
+                entry, new_entry.get(), memory_order_release, memory_order_acquire
+            )) {
+                size_.fetch_add(1, memory_order_relaxed);
+                return *new_entry.release();
+            }
+            // lost the race, entry now holds the winner
+        }
+        if (entry->getKey() == key) {
+            if (entry->getActionCount() != n_actions) {
+                throw logic_error("Info set has a different number of actions than its node");
+            }
+            return *entry;
+        }
+        slot = (slot + 1) & mask_;
+    }
+    throw length_error(
+        "ConcurrentInfoSetTable is full, capacity " + to_string(mask_ + 1)
+    );
+}
+
+template <InfoSetKey Key>
+size_t ConcurrentInfoSetTable<Key>::size() const {
+    return size_.load(memory_order_relaxed);
+}
+
+template <InfoSetKey Key>
+size_t ConcurrentInfoSetTable<Key>::getCapacity() const {
+    return mask_ + 1;
+}
+
+template <InfoSetKey Key>
+InfoSetMap<Key> ConcurrentInfoSetTable<Key>::toInfoSetMap() const {
+    InfoSetMap<Key> infosets;
+    infosets.reserve(size());
+    for (size_t slot = 0; slot <= mask_; slot++) {
+        const Entry* entry = slots_[slot].load(memory_order_acquire);
+        if (entry != nullptr) {
+            infosets.try_emplace(
+                entry->getKey(), entry->getRegretSum(), entry->getCumulativeStrategySum()
+            );
+        }
+    }
+    return infosets;
+}
+
+// Explicit instantiation definitions
+template class ConcurrentInfoSetTable<string>;
+template class ConcurrentInfoSetTable<size_t>;
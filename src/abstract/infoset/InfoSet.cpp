@@ -1,19 +1,38 @@
 #include "abstract/infoset/InfoSet.h"
+#include <algorithm>
 #include <functional>
+#include <stdexcept>
+#include <utility>
 #include "Utils.h"
 
 
 InfoSet::InfoSet(int n_actions) 
     : instant_regret_(n_actions, 0.0),
-    regret_sum_(n_actions, 20.0), // TODO return to 0
+    regret_sum_(n_actions, INITIAL_REGRET_SUM),
     regret_sum_strategy_uptodate_(false),
     regret_sum_strategy_(n_actions, 0.0),
     cumulative_strategy_not_norm_(n_actions, 0.0),
     cumulative_strategy_uptodate_(false),
-    cumulative_strategy_normalized_(n_actions, 0.0)
+    cumulative_strategy_normalized_(n_actions, 0.0),
+    regret_iteration_(-1)
 {
 }
 
+InfoSet::InfoSet(const vector<double>& regret_sum, const vector<double>& cumulative_strategy_sum)
+    : instant_regret_(regret_sum.size(), 0.0),
+    regret_sum_(regret_sum),
+    regret_sum_strategy_uptodate_(false),
+    regret_sum_strategy_(regret_sum.size(), 0.0),
+    cumulative_strategy_not_norm_(cumulative_strategy_sum),
+    cumulative_strategy_uptodate_(false),
+    cumulative_strategy_normalized_(regret_sum.size(), 0.0),
+    regret_iteration_(-1)
+{
+    if (cumulative_strategy_sum.size() != regret_sum.size()) {
+        throw invalid_argument("Regret sum and cumulative strategy sum differ in size");
+    }
+}
+
 InfoSet::InfoSet(const InfoSet& other)
     : instant_regret_(other.instant_regret_),
     regret_sum_(other.regret_sum_),
@@ -21,7 +40,10 @@ InfoSet::InfoSet(const InfoSet& other)
     regret_sum_strategy_(other.regret_sum_strategy_),
     cumulative_strategy_not_norm_(other.cumulative_strategy_not_norm_),
     cumulative_strategy_uptodate_(other.cumulative_strategy_uptodate_),
-    cumulative_strategy_normalized_(other.cumulative_strategy_normalized_)
+    cumulative_strategy_normalized_(other.cumulative_strategy_normalized_),
+    predicted_regret_(other.predicted_regret_),
+    iteration_regret_(other.iteration_regret_),
+    regret_iteration_(other.regret_iteration_)
 {
 }
 
@@ -30,14 +52,8 @@ void InfoSet::setInstantRegret(int action_idx, double regret) {
 }
 
 void InfoSet::accumulateRegret(double weight) {
-    for (size_t action_idx = 0; action_idx < instant_regret_.size(); action_idx++) {
-        this->regret_sum_[action_idx] += weight * instant_regret_[action_idx];
-    }
-
-    // Ensure all regret sums are non-negative
-    for (size_t i = 0; i < regret_sum_.size(); i++) {
-        regret_sum_[i] = max(0.0, regret_sum_[i]);
-    }
+    // regret sums stay non-negative
+    cfr_utils::accumulatePositiveRegret(regret_sum_, weight, instant_regret_);
 
     // only when instant regrets are added to cumulative regrets
     // the old regretsum strategy becomes outdated
@@ -45,13 +61,53 @@ void InfoSet::accumulateRegret(double weight) {
 }
 
 void InfoSet::accumulateStrategy(double weight) {
-    const vector<double>& strategy = getRegretSumStrategy();
-    for (size_t i = 0; i < strategy.size(); i++) {
-        cumulative_strategy_not_norm_[i] += weight * strategy[i];
-    }
+    cfr_utils::accumulateWeighted(cumulative_strategy_not_norm_, weight, getRegretSumStrategy());
+    cumulative_strategy_uptodate_ = false;
+}
+
+void InfoSet::accumulateStrategy(double weight, const vector<double>& strategy) {
+    cfr_utils::accumulateWeighted(cumulative_strategy_not_norm_, weight, strategy);
     cumulative_strategy_uptodate_ = false;
 }
 
+void InfoSet::startIteration(int iteration) {
+    if (iteration == regret_iteration_) {
+        return;
+    }
+    if (iteration_regret_.empty()) {
+        iteration_regret_.assign(instant_regret_.size(), 0.0);
+        predicted_regret_.assign(instant_regret_.size(), 0.0);
+    }
+    swap(predicted_regret_, iteration_regret_);
+    fill(iteration_regret_.begin(), iteration_regret_.end(), 0.0);
+    regret_iteration_ = iteration;
+}
+
+void InfoSet::accumulatePredictiveRegret(double weight) {
+    if (iteration_regret_.empty()) {
+        iteration_regret_.assign(instant_regret_.size(), 0.0);
+    }
+    for (size_t action_idx = 0; action_idx < instant_regret_.size(); action_idx++) {
+        iteration_regret_[action_idx] += weight * instant_regret_[action_idx];
+    }
+    accumulateRegret(weight);
+}
+
+const vector<double>& InfoSet::getPredictedRegret() const {
+    return predicted_regret_;
+}
+
+vector<double> InfoSet::getPredictiveStrategy() const {
+    if (predicted_regret_.empty()) {
+        return strategy_utils::normalizeStrategy(regret_sum_);
+    }
+    vector<double> predicted_sum(regret_sum_.size());
+    for (size_t i = 0; i < regret_sum_.size(); i++) {
+        predicted_sum[i] = regret_sum_[i] + predicted_regret_[i];
+    }
+    return strategy_utils::normalizeStrategy(predicted_sum);
+}
+
 const vector<double>& InfoSet::getInstantRegret() const {
     return instant_regret_;
 }
@@ -60,6 +116,10 @@ const vector<double>& InfoSet::getRegretSum() const {
     return regret_sum_;
 }
 
+const vector<double>& InfoSet::getCumulativeStrategySum() const {
+    return cumulative_strategy_not_norm_;
+}
+
 const vector<double>& InfoSet::getRegretSumStrategy() {
     if (!regret_sum_strategy_uptodate_) {
         // Normalize the strategy - this step can be precomputed
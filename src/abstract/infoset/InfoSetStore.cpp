@@ -0,0 +1,247 @@
+#include "abstract/infoset/InfoSetStore.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace {
+    [[noreturn]]
+    void throwSystemError(const string& what) {
+        throw runtime_error(what + ": " + strerror(errno));
+    }
+}
+
+
+template <InfoSetKey Key>
+InfoSetStore<Key>::InfoSetStore(const Params& params)
+    : params_(params),
+    fd_(-1),
+    data_(nullptr),
+    mapped_bytes_(0),
+    used_bytes_(0),
+    n_resident_(0),
+    max_resident_(0),
+    n_accesses_(0),
+    n_faults_(0),
+    n_evictions_(0),
+    n_prefetches_(0)
+{
+    // segments are whole pages so they can be dropped independently
+    size_t page_bytes = sysconf(_SC_PAGESIZE);
+    params_.segment_bytes = max(params_.segment_bytes, page_bytes);
+    params_.segment_bytes = (params_.segment_bytes + page_bytes - 1) / page_bytes * page_bytes;
+    // a record spans at most two segments, both must fit at once
+    max_resident_ = max<size_t>(2, params_.memory_budget_bytes / params_.segment_bytes);
+
+    string directory = params_.directory;
+    if (directory.empty()) {
+        const char* tmpdir = getenv("TMPDIR");
+        directory = tmpdir != nullptr ? tmpdir : "/tmp";
+    }
+    string path = directory + "/infoset_store_XXXXXX";
+    fd_ = mkstemp(path.data());
+    if (fd_ < 0) {
+        throwSystemError("Cannot create spill file in " + directory);
+    }
+    unlink(path.c_str());
+    record_offsets_.push_back(0);
+}
+
+template <InfoSetKey Key>
+InfoSetStore<Key>::~InfoSetStore() {
+    if (data_ != nullptr) {
+        munmap(data_, mapped_bytes_);
+    }
+    if (fd_ >= 0) {
+        close(fd_);
+    }
+}
+
+template <InfoSetKey Key>
+void InfoSetStore<Key>::reserve(size_t file_bytes) {
+    if (file_bytes <= mapped_bytes_) {
+        return;
+    }
+    size_t new_bytes = max(file_bytes, 2 * mapped_bytes_);
+    new_bytes = (new_bytes + params_.segment_bytes - 1) / params_.segment_bytes * params_.segment_bytes;
+
+    if (ftruncate(fd_, new_bytes) != 0) {
+        throwSystemError("Cannot grow spill file");
+    }
+    void* data = data_ == nullptr ?
+        mmap(nullptr, new_bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0) :
+        mremap(data_, mapped_bytes_, new_bytes, MREMAP_MAYMOVE);
+    if (data == MAP_FAILED) {
+        throwSystemError("Cannot map spill file");
+    }
+    data_ = static_cast<char*>(data);
+    mapped_bytes_ = new_bytes;
+
+    size_t n_segments = mapped_bytes_ / params_.segment_bytes;
+    resident_.resize(n_segments, 0);
+    lru_position_.resize(n_segments, lru_.end());
+}
+
+template <InfoSetKey Key>
+size_t InfoSetStore<Key>::insert(
+    const Key& key,
+    span<const double> regret_sum,
+    span<const double> cumulative_strategy_sum
+) {
+    if (regret_sum.size() != cumulative_strategy_sum.size()) {
+        throw invalid_argument("Regret sum and cumulative strategy sum differ in size");
+    }
+    auto it = ids_.find(key);
+    if (it != ids_.end()) {
+        if (getActionCount(it->second) != regret_sum.size()) {
+            throw logic_error("Info set has a different number of actions than its node");
+        }
+        return it->second;
+    }
+
+    size_t n_actions = regret_sum.size();
+    size_t begin = used_bytes_;
+    size_t end = begin + 2 * n_actions * sizeof(double);
+    reserve(end);
+    touch(begin, end);
+    double* record = reinterpret_cast<double*>(data_ + begin);
+    copy(regret_sum.begin(), regret_sum.end(), record);
+    copy(cumulative_strategy_sum.begin(), cumulative_strategy_sum.end(), record + n_actions);
+    used_bytes_ = end;
+
+    size_t id = keys_.size();
+    keys_.push_back(&ids_.emplace(key, id).first->first);
+    record_offsets_.push_back(end);
+    return id;
+}
+
+template <InfoSetKey Key>
+size_t InfoSetStore<Key>::find(const Key& key) const {
+    auto it = ids_.find(key);
+    return it == ids_.end() ? NOT_FOUND : it->second;
+}
+
+template <InfoSetKey Key>
+size_t InfoSetStore<Key>::size() const {
+    return keys_.size();
+}
+
+template <InfoSetKey Key>
+size_t InfoSetStore<Key>::getActionCount(size_t id) const {
+    return (record_offsets_[id + 1] - record_offsets_[id]) / (2 * sizeof(double));
+}
+
+template <InfoSetKey Key>
+const Key& InfoSetStore<Key>::getKey(size_t id) const {
+    return *keys_[id];
+}
+
+template <InfoSetKey Key>
+span<double> InfoSetStore<Key>::getRegretSum(size_t id) {
+    size_t n_actions = getActionCount(id);
+    size_t begin = record_offsets_[id];
+    touch(begin, begin + n_actions * sizeof(double));
+    return span<double>(reinterpret_cast<double*>(data_ + begin), n_actions);
+}
+
+template <InfoSetKey Key>
+span<double> InfoSetStore<Key>::getCumulativeStrategySum(size_t id) {
+    size_t n_actions = getActionCount(id);
+    size_t begin = record_offsets_[id] + n_actions * sizeof(double);
+    touch(begin, begin + n_actions * sizeof(double));
+    return span<double>(reinterpret_cast<double*>(data_ + begin), n_actions);
+}
+
+template <InfoSetKey Key>
+void InfoSetStore<Key>::touch(size_t begin, size_t end) {
+    n_accesses_++;
+    size_t first_segment = begin / params_.segment_bytes;
+    size_t last_segment = (max(end, begin + 1) - 1) / params_.segment_bytes;
+    for (size_t segment = first_segment; segment <= last_segment; segment++) {
+        if (resident_[segment]) {
+            lru_.splice(lru_.begin(), lru_, lru_position_[segment]);
+            continue;
+        }
+        n_faults_++;
+        makeResident(segment);
+        // traversals move forward through the file, read the next segment ahead
+        size_t next_segment = segment + 1;
+        if (next_segment * params_.segment_bytes < used_bytes_ && !resident_[next_segment]) {
+            madvise(
+                data_ + next_segment * params_.segment_bytes,
+                params_.segment_bytes, MADV_WILLNEED
+            );
+            n_prefetches_++;
+            makeResident(next_segment);
+            // the faulting segment stays the most recently used
+            lru_.splice(lru_.begin(), lru_, lru_position_[segment]);
+        }
+    }
+}
+
+template <InfoSetKey Key>
+void InfoSetStore<Key>::makeResident(size_t segment) {
+    resident_[segment] = 1;
+    lru_.push_front(segment);
+    lru_position_[segment] = lru_.begin();
+    n_resident_++;
+    while (n_resident_ > max_resident_) {
+        evictSegment(lru_.back());
+    }
+}
+
+template <InfoSetKey Key>
+void InfoSetStore<Key>::evictSegment(size_t segment) {
+    char* address = data_ + segment * params_.segment_bytes;
+    off_t offset = segment * params_.segment_bytes;
+    // write back, then drop the pages from the mapping and the page cache
+    msync(address, params_.segment_bytes, MS_SYNC);
+    madvise(address, params_.segment_bytes, MADV_DONTNEED);
+    posix_fadvise(fd_, offset, params_.segment_bytes, POSIX_FADV_DONTNEED);
+
+    lru_.erase(lru_position_[segment]);
+    lru_position_[segment] = lru_.end();
+    resident_[segment] = 0;
+    n_resident_--;
+    n_evictions_++;
+}
+
+template <InfoSetKey Key>
+typename InfoSetStore<Key>::Statistics InfoSetStore<Key>::getStatistics() const {
+    size_t used_segments = (used_bytes_ + params_.segment_bytes - 1) / params_.segment_bytes;
+    Statistics statistics;
+    statistics.n_infosets = keys_.size();
+    statistics.file_bytes = used_bytes_;
+    statistics.resident_segments = n_resident_;
+    statistics.spilled_segments = used_segments - min(used_segments, n_resident_);
+    statistics.n_accesses = n_accesses_;
+    statistics.n_faults = n_faults_;
+    statistics.n_evictions = n_evictions_;
+    statistics.n_prefetches = n_prefetches_;
+    statistics.fault_rate = n_accesses_ == 0 ? 0.0 : (double) n_faults_ / n_accesses_;
+    return statistics;
+}
+
+template <InfoSetKey Key>
+InfoSetMap<Key> InfoSetStore<Key>::toInfoSetMap() {
+    InfoSetMap<Key> infosets;
+    infosets.reserve(keys_.size());
+    for (size_t id = 0; id < keys_.size(); id++) {
+        span<double> regret_sum = getRegretSum(id);
+        span<double> strategy_sum = getCumulativeStrategySum(id);
+        infosets.try_emplace(
+            *keys_[id],
+            vector<double>(regret_sum.begin(), regret_sum.end()),
+            vector<double>(strategy_sum.begin(), strategy_sum.end())
+        );
+    }
+    return infosets;
+}
+
+// Explicit instantiation definitions
+template class InfoSetStore<string>;
+template class InfoSetStore<size_t>;
@@ -80,6 +80,14 @@ size_t GameNode::getInfoSetKeyInt() const {
     return hash<string>{}(getInfoSetKeyString());
 }
 
+bool GameNode::hasStateHash() const {
+    return false;
+}
+
+uint64_t GameNode::getStateHash() const {
+    throwMissingFnException("getStateHash");
+}
+
 void GameNode::throwWrongNodeTypeFnException(const string& funcName) const {
     throw logic_error(
         string("Node of class ") + cpp_utils::demangle(typeid(*this).name()) + ", " +
@@ -0,0 +1,72 @@
+#include "abstract/nodes/MultiRootNode.h"
+#include <numeric>
+#include <stdexcept>
+
+
+MultiRootNode::MultiRootNode(
+    const vector<shared_ptr<const GameNode>>& roots,
+    const vector<double>& weights
+) :
+    roots_(roots),
+    weights_(weights)
+{
+    if (roots_.empty()) {
+        throw invalid_argument("MultiRootNode requires at least one root");
+    }
+    if (weights_.size() != roots_.size()) {
+        throw invalid_argument(
+            "MultiRootNode got " + to_string(roots_.size()) + " roots and " +
+            to_string(weights_.size()) + " weights"
+        );
+    }
+    for (size_t i = 0; i < roots_.size(); i++) {
+        if (!roots_[i]) {
+            throw invalid_argument("Root " + to_string(i) + " is null");
+        }
+        if (!(weights_[i] >= 0)) {
+            throw invalid_argument("Weight of root " + to_string(i) + " is not a non-negative number");
+        }
+    }
+    double total_weight = accumulate(weights_.begin(), weights_.end(), 0.0);
+    if (total_weight <= 0) {
+        throw invalid_argument("MultiRootNode weights sum to zero");
+    }
+
+    probabilities_.reserve(weights_.size());
+    for (double weight : weights_) {
+        probabilities_.push_back(weight / total_weight);
+    }
+    actions_.resize(roots_.size());
+    iota(actions_.begin(), actions_.end(), 0);
+}
+
+string MultiRootNode::toString() const {
+    return "MultiRootNode(" + to_string(roots_.size()) + " roots)";
+}
+
+string MultiRootNode::actionToString(int action) const {
+    return "root " + to_string(action);
+}
+
+const vector<double>& MultiRootNode::getChanceProbabilities() const {
+    return probabilities_;
+}
+
+const vector<int>& MultiRootNode::getLegalActions() const {
+    return actions_;
+}
+
+shared_ptr<const GameNode> MultiRootNode::applyAction(int action) const {
+    if (action < 0 || static_cast<size_t>(action) >= roots_.size()) {
+        throw out_of_range("MultiRootNode has no root " + to_string(action));
+    }
+    return roots_[action];
+}
+
+size_t MultiRootNode::getRootCount() const {
+    return roots_.size();
+}
+
+const vector<double>& MultiRootNode::getWeights() const {
+    return weights_;
+}
@@ -0,0 +1,46 @@
+#include "abstract/nodes/PublicTreeNode.h"
+#include "Utils.h"
+#include <functional>
+#include <stdexcept>
+#include <typeinfo>
+
+
+string PublicTreeNode::getTypeString() const {
+    switch (getType()) {
+        case GameNode::Type::Terminal: return "Terminal";
+        case GameNode::Type::Chance: return "Chance";
+        case GameNode::Type::Decision: return "Decision";
+        default: throw logic_error("Unknown PublicTreeNode type");
+    }
+}
+
+vector<double> PublicTreeNode::getTerminalUtilityMatrix(int) const {
+    throwWrongNodeTypeFnException("getTerminalUtilityMatrix");
+}
+
+int PublicTreeNode::getCurrentPlayer() const {
+    throwWrongNodeTypeFnException("getCurrentPlayer");
+}
+
+const vector<int>& PublicTreeNode::getLegalActions() const {
+    throwWrongNodeTypeFnException("getLegalActions");
+}
+
+shared_ptr<const PublicTreeNode> PublicTreeNode::applyAction(int) const {
+    throwWrongNodeTypeFnException("applyAction");
+}
+
+string PublicTreeNode::getInfoSetKeyString(size_t) const {
+    throwWrongNodeTypeFnException("getInfoSetKeyString");
+}
+
+size_t PublicTreeNode::getInfoSetKeyInt(size_t private_state) const {
+    return hash<string>{}(getInfoSetKeyString(private_state));
+}
+
+void PublicTreeNode::throwWrongNodeTypeFnException(const string& funcName) const {
+    throw logic_error(
+        string("Public node of class ") + cpp_utils::demangle(typeid(*this).name()) + ", " +
+        "of type " + getTypeString() + " does not implement " + funcName + "()"
+    );
+}
@@ -0,0 +1,107 @@
+#include "abstract/strategy/ActionSampler.h"
+#include <cmath>
+#include <stdexcept>
+
+
+template <InfoSetKey Key>
+ActionSampler<Key>::ActionSampler(shared_ptr<const PolicyTable<Key>> policy_table)
+    : policy_table_(policy_table)
+{
+    if (!policy_table_) {
+        throw invalid_argument("Policy table cannot be null");
+    }
+    const vector<double>& probabilities = policy_table_->getProbabilities();
+    keep_threshold_.resize(probabilities.size());
+    alias_.resize(probabilities.size());
+
+    vector<double> scaled;
+    vector<uint32_t> small;
+    vector<uint32_t> large;
+    for (size_t row = 0; row < policy_table_->size(); row++) {
+        span<const double> strategy = policy_table_->getRowStrategy(row);
+        size_t offset = policy_table_->getOffsets()[row];
+        size_t n = strategy.size();
+
+        // Vose's alias method on probabilities scaled to mean 1
+        scaled.assign(n, 0.0);
+        small.clear();
+        large.clear();
+        for (size_t i = 0; i < n; i++) {
+            scaled[i] = strategy[i] * n;
+            (scaled[i] < 1.0 ? small : large).push_back(i);
+        }
+        while (!small.empty() && !large.empty()) {
+            uint32_t s = small.back();
+            uint32_t l = large.back();
+            small.pop_back();
+            large.pop_back();
+
+            keep_threshold_[offset + s] = static_cast<uint32_t>(ldexp(scaled[s], 32));
+            alias_[offset + s] = l;
+
+            scaled[l] -= 1.0 - scaled[s];
+            (scaled[l] < 1.0 ? small : large).push_back(l);
+        }
+        // leftovers are 1 up to rounding, they always keep their column
+        for (const vector<uint32_t>* rest : {&small, &large}) {
+            for (uint32_t i : *rest) {
+                keep_threshold_[offset + i] = UINT32_MAX;
+                alias_[offset + i] = i;
+            }
+        }
+    }
+}
+
+template <InfoSetKey Key>
+int ActionSampler<Key>::sampleRowWith(size_t row, uint64_t random) const {
+    size_t offset = policy_table_->getOffsets()[row];
+    uint64_t n = policy_table_->getOffsets()[row + 1] - offset;
+
+    // high 32 bits pick the column, low 32 bits the column or its alias
+    uint32_t column = static_cast<uint32_t>(((random >> 32) * n) >> 32);
+    uint32_t coin = static_cast<uint32_t>(random);
+    return coin < keep_threshold_[offset + column] ?
+        column : alias_[offset + column];
+}
+
+template <InfoSetKey Key>
+int ActionSampler<Key>::sampleRow(size_t row, cpp_utils::CounterRng& rng) const {
+    return sampleRowWith(row, rng());
+}
+
+template <InfoSetKey Key>
+int ActionSampler<Key>::sample(const Key& key, cpp_utils::CounterRng& rng) const {
+    size_t row = policy_table_->findRow(key);
+    if (row == PolicyTable<Key>::NOT_FOUND) {
+        throw out_of_range("InfoSet not found for key in policy table");
+    }
+    return sampleRow(row, rng);
+}
+
+template <InfoSetKey Key>
+void ActionSampler<Key>::sampleBatch(
+    span<const Key> keys,
+    span<int> actions,
+    uint64_t seed,
+    uint64_t stream,
+    uint64_t start_counter
+) const {
+    if (actions.size() < keys.size()) {
+        throw invalid_argument("Output buffer is smaller than the number of keys");
+    }
+    cpp_utils::CounterRng rng(seed, stream);
+    for (size_t i = 0; i < keys.size(); i++) {
+        size_t row = policy_table_->findRow(keys[i]);
+        actions[i] = (row == PolicyTable<Key>::NOT_FOUND) ?
+            -1 : sampleRowWith(row, rng.at(start_counter + i));
+    }
+}
+
+template <InfoSetKey Key>
+const PolicyTable<Key>& ActionSampler<Key>::getPolicyTable() const {
+    return *policy_table_;
+}
+
+// Explicit instantiation definitions
+template class ActionSampler<string>;
+template class ActionSampler<size_t>;
@@ -0,0 +1,313 @@
+#include "abstract/strategy/BestResponse.h"
+#include "Utils.h"
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+
+template <InfoSetKey Key>
+BestResponse<Key>::BestResponse(
+    shared_ptr<const GameNode> root,
+    MissingInfoSet missing_infoset
+) :
+    missing_infoset_(missing_infoset),
+    n_players_(0)
+{
+    if (!root) {
+        throw invalid_argument("Root node cannot be null");
+    }
+
+    vector<int> own_decisions;
+    addNode(root, own_decisions);
+    node_first_edge_.push_back(edge_child_.size());
+
+    player_levels_.resize(n_players_);
+    for (size_t infoset = 0; infoset < infoset_keys_.size(); infoset++) {
+        int player = infoset_player_[infoset];
+        if (player < 0 || player >= n_players_) {
+            throw logic_error("Decision node player " + to_string(player) + " is out of range");
+        }
+        size_t level = infoset_level_[infoset];
+        if (player_levels_[player].size() <= level) {
+            player_levels_[player].resize(level + 1);
+        }
+        player_levels_[player][level].push_back(infoset);
+    }
+}
+
+template <InfoSetKey Key>
+size_t BestResponse<Key>::getInfoSet(const shared_ptr<const GameNode>& node, int own_decisions) {
+    Key key = node->getInfoSetKey<Key>();
+    int player = node->getCurrentPlayer();
+    size_t n_actions = node->getLegalActions().size();
+
+    auto it = infoset_ids_.find(key);
+    if (it != infoset_ids_.end()) {
+        size_t infoset = it->second;
+        if (infoset_player_[infoset] != player ||
+            infoset_offsets_[infoset + 1] - infoset_offsets_[infoset] != n_actions) {
+            throw logic_error("Nodes of an info set disagree on player or number of actions");
+        }
+        if (infoset_level_[infoset] != own_decisions) {
+            throw logic_error("Best response requires a game with perfect recall");
+        }
+        return infoset;
+    }
+
+    size_t infoset = infoset_keys_.size();
+    if (infoset_offsets_.empty()) {
+        infoset_offsets_.push_back(0);
+    }
+    infoset_ids_.emplace(key, infoset);
+    infoset_keys_.push_back(key);
+    infoset_player_.push_back(player);
+    infoset_offsets_.push_back(infoset_offsets_.back() + n_actions);
+    infoset_nodes_.emplace_back();
+    infoset_level_.push_back(own_decisions);
+    return infoset;
+}
+
+template <InfoSetKey Key>
+size_t BestResponse<Key>::addNode(
+    const shared_ptr<const GameNode>& node, vector<int>& own_decisions
+) {
+    size_t node_idx = node_type_.size();
+    GameNode::Type type = node->getType();
+    node_type_.push_back(type);
+    node_player_.push_back(-1);
+    node_slot_.push_back(0);
+    node_first_edge_.push_back(edge_child_.size());
+
+    if (type == GameNode::Type::Terminal) {
+        const vector<double>& utilities = node->getTerminalUtilities();
+        if (n_players_ == 0) {
+            n_players_ = utilities.size();
+        } else if ((int) utilities.size() != n_players_) {
+            throw logic_error("Terminal nodes disagree on the number of players");
+        }
+        node_slot_[node_idx] = utilities_.size();
+        utilities_.insert(utilities_.end(), utilities.begin(), utilities.end());
+        return node_idx;
+    }
+
+    const vector<int>& actions = node->getLegalActions();
+    size_t first_edge = edge_child_.size();
+    edge_child_.resize(first_edge + actions.size());
+    edge_probability_.resize(first_edge + actions.size(), 0.0);
+
+    if (type == GameNode::Type::Chance) {
+        const vector<double>& probabilities = node->getChanceProbabilities();
+        copy(probabilities.begin(), probabilities.end(), edge_probability_.begin() + first_edge);
+        for (size_t action_idx = 0; action_idx < actions.size(); action_idx++) {
+            edge_child_[first_edge + action_idx] =
+                addNode(node->applyAction(actions[action_idx]), own_decisions);
+        }
+        return node_idx;
+    }
+
+    int player = node->getCurrentPlayer();
+    if (player < 0) {
+        throw logic_error("Decision node has a negative player");
+    }
+    if ((int) own_decisions.size() <= player) {
+        own_decisions.resize(player + 1, 0);
+    }
+    size_t infoset = getInfoSet(node, own_decisions[player]);
+    node_player_[node_idx] = player;
+    node_slot_[node_idx] = infoset;
+    infoset_nodes_[infoset].push_back(node_idx);
+
+    own_decisions[player]++;
+    for (size_t action_idx = 0; action_idx < actions.size(); action_idx++) {
+        edge_child_[first_edge + action_idx] =
+            addNode(node->applyAction(actions[action_idx]), own_decisions);
+    }
+    own_decisions[player]--;
+    return node_idx;
+}
+
+template <InfoSetKey Key>
+vector<double> BestResponse<Key>::collectStrategy(const PolicyTable<Key>& policy) const {
+    vector<double> probabilities(infoset_offsets_.empty() ? 0 : infoset_offsets_.back());
+    for (size_t infoset = 0; infoset < infoset_keys_.size(); infoset++) {
+        size_t offset = infoset_offsets_[infoset];
+        size_t n_actions = infoset_offsets_[infoset + 1] - offset;
+
+        size_t row = policy.findRow(infoset_keys_[infoset]);
+        if (row == PolicyTable<Key>::NOT_FOUND) {
+            if (missing_infoset_ == MissingInfoSet::Throw) {
+                throw out_of_range("InfoSet not found for key in strategy");
+            }
+            fill_n(probabilities.begin() + offset, n_actions, 1.0 / n_actions);
+            continue;
+        }
+
+        span<const double> strategy = policy.getRowStrategy(row);
+        if (strategy.size() != n_actions) {
+            throw invalid_argument("Strategy size does not match the number of legal actions");
+        }
+        copy(strategy.begin(), strategy.end(), probabilities.begin() + offset);
+    }
+    return probabilities;
+}
+
+template <InfoSetKey Key>
+double BestResponse<Key>::bestResponseValue(
+    size_t node, int player, const vector<double>& probabilities, vector<double>& values
+) const {
+    if (!isnan(values[node])) {
+        return values[node];
+    }
+
+    double value = 0;
+    switch (node_type_[node]) {
+    case GameNode::Type::Terminal:
+        value = utilities_[node_slot_[node] + player];
+        break;
+
+    case GameNode::Type::Chance:
+        for (size_t edge = node_first_edge_[node]; edge < node_first_edge_[node + 1]; edge++) {
+            value += edge_probability_[edge] *
+                bestResponseValue(edge_child_[edge], player, probabilities, values);
+        }
+        break;
+
+    case GameNode::Type::Decision: {
+        if (node_player_[node] == player) {
+            // info sets of the player are resolved deepest level first
+            throw logic_error("Best response info set evaluated before it was resolved");
+        }
+        const double* strategy = probabilities.data() + infoset_offsets_[node_slot_[node]];
+        for (size_t edge = node_first_edge_[node]; edge < node_first_edge_[node + 1]; edge++) {
+            value += strategy[edge - node_first_edge_[node]] *
+                bestResponseValue(edge_child_[edge], player, probabilities, values);
+        }
+        break;
+    }
+    }
+
+    values[node] = value;
+    return value;
+}
+
+template <InfoSetKey Key>
+typename BestResponse<Key>::Result BestResponse<Key>::compute(
+    const InfoSetMap<Key>& strategy, int n_threads
+) const {
+    return compute(PolicyTable<Key>(strategy), n_threads);
+}
+
+template <InfoSetKey Key>
+typename BestResponse<Key>::Result BestResponse<Key>::compute(
+    const PolicyTable<Key>& policy, int n_threads
+) const {
+    vector<double> probabilities = collectStrategy(policy);
+    size_t n_nodes = node_type_.size();
+
+    Result result;
+    result.best_response_values.resize(n_players_);
+    result.strategy_values.resize(n_players_);
+
+    // children come after their parents, so one backward sweep evaluates the profile
+    vector<double> values(n_nodes * n_players_);
+    for (size_t node = n_nodes; node-- > 0;) {
+        double* node_values = values.data() + node * n_players_;
+        if (node_type_[node] == GameNode::Type::Terminal) {
+            copy_n(utilities_.begin() + node_slot_[node], n_players_, node_values);
+            continue;
+        }
+        fill_n(node_values, n_players_, 0.0);
+        const double* strategy = node_type_[node] == GameNode::Type::Chance
+            ? edge_probability_.data() + node_first_edge_[node]
+            : probabilities.data() + infoset_offsets_[node_slot_[node]];
+        for (size_t edge = node_first_edge_[node]; edge < node_first_edge_[node + 1]; edge++) {
+            const double* child_values = values.data() + edge_child_[edge] * n_players_;
+            double probability = strategy[edge - node_first_edge_[node]];
+            for (int p = 0; p < n_players_; p++) {
+                node_values[p] += probability * child_values[p];
+            }
+        }
+    }
+    copy_n(values.begin(), n_players_, result.strategy_values.begin());
+
+    vector<double> reach(n_nodes);
+    for (int player = 0; player < n_players_; player++) {
+        // reach of opponents and chance, the player's own probabilities are left out
+        reach[0] = 1.0;
+        for (size_t node = 0; node < n_nodes; node++) {
+            if (node_type_[node] == GameNode::Type::Terminal) {
+                continue;
+            }
+            const double* strategy = nullptr;
+            if (node_type_[node] == GameNode::Type::Chance) {
+                strategy = edge_probability_.data() + node_first_edge_[node];
+            } else if (node_player_[node] != player) {
+                strategy = probabilities.data() + infoset_offsets_[node_slot_[node]];
+            }
+            for (size_t edge = node_first_edge_[node]; edge < node_first_edge_[node + 1]; edge++) {
+                reach[edge_child_[edge]] = reach[node] *
+                    (strategy ? strategy[edge - node_first_edge_[node]] : 1.0);
+            }
+        }
+
+        vector<double> br_values(n_nodes, numeric_limits<double>::quiet_NaN());
+        const vector<vector<size_t>>& levels = player_levels_[player];
+        for (size_t level = levels.size(); level-- > 0;) {
+            const vector<size_t>& level_infosets = levels[level];
+            cpp_utils::parallelFor(level_infosets.size(), n_threads, [&](size_t i) {
+                size_t infoset = level_infosets[i];
+                size_t n_actions = infoset_offsets_[infoset + 1] - infoset_offsets_[infoset];
+                const vector<size_t>& nodes = infoset_nodes_[infoset];
+
+                // counterfactual value of every action summed over the histories
+                vector<double> action_values(n_actions, 0.0);
+                for (size_t node : nodes) {
+                    size_t first_edge = node_first_edge_[node];
+                    for (size_t action_idx = 0; action_idx < n_actions; action_idx++) {
+                        action_values[action_idx] += reach[node] * bestResponseValue(
+                            edge_child_[first_edge + action_idx], player, probabilities, br_values
+                        );
+                    }
+                }
+
+                size_t best_action = 0;
+                for (size_t action_idx = 1; action_idx < n_actions; action_idx++) {
+                    if (action_values[action_idx] > action_values[best_action]) {
+                        best_action = action_idx;
+                    }
+                }
+                for (size_t node : nodes) {
+                    br_values[node] = br_values[edge_child_[node_first_edge_[node] + best_action]];
+                }
+            });
+        }
+        result.best_response_values[player] =
+            bestResponseValue(0, player, probabilities, br_values);
+    }
+
+    result.nash_conv = 0;
+    for (int p = 0; p < n_players_; p++) {
+        result.nash_conv += result.best_response_values[p] - result.strategy_values[p];
+    }
+    result.exploitability = result.nash_conv / n_players_;
+    return result;
+}
+
+template <InfoSetKey Key>
+int BestResponse<Key>::getPlayerCount() const {
+    return n_players_;
+}
+
+template <InfoSetKey Key>
+size_t BestResponse<Key>::getNodeCount() const {
+    return node_type_.size();
+}
+
+template <InfoSetKey Key>
+size_t BestResponse<Key>::getInfoSetCount() const {
+    return infoset_keys_.size();
+}
+
+// Explicit instantiation definitions
+template class BestResponse<string>;
+template class BestResponse<size_t>;
@@ -0,0 +1,234 @@
+#include "abstract/strategy/HeadToHead.h"
+#include <array>
+#include <stdexcept>
+
+
+template <InfoSetKey Key>
+HeadToHead<Key>::HeadToHead(
+    shared_ptr<const GameNode> root,
+    MissingInfoSet missing_infoset
+) :
+    missing_infoset_(missing_infoset),
+    n_players_(0)
+{
+    if (!root) {
+        throw invalid_argument("Root node cannot be null");
+    }
+    infoset_offsets_.push_back(0);
+    addNode(root);
+    node_first_edge_.push_back(edge_child_.size());
+
+    state_nodes_.clear();
+    state_nodes_.rehash(0);
+
+    for (int player : infoset_player_) {
+        if (player < 0 || player >= n_players_) {
+            throw logic_error("Decision node player " + to_string(player) + " is out of range");
+        }
+    }
+}
+
+template <InfoSetKey Key>
+size_t HeadToHead<Key>::getInfoSet(const shared_ptr<const GameNode>& node) {
+    Key key = node->getInfoSetKey<Key>();
+    int player = node->getCurrentPlayer();
+    size_t n_actions = node->getLegalActions().size();
+
+    auto it = infoset_ids_.find(key);
+    if (it != infoset_ids_.end()) {
+        size_t infoset = it->second;
+        if (infoset_player_[infoset] != player ||
+            infoset_offsets_[infoset + 1] - infoset_offsets_[infoset] != n_actions) {
+            throw logic_error("Nodes of an info set disagree on player or number of actions");
+        }
+        return infoset;
+    }
+
+    size_t infoset = infoset_keys_.size();
+    infoset_ids_.emplace(key, infoset);
+    infoset_keys_.push_back(key);
+    infoset_player_.push_back(player);
+    infoset_offsets_.push_back(infoset_offsets_.back() + n_actions);
+    return infoset;
+}
+
+template <InfoSetKey Key>
+size_t HeadToHead<Key>::addNode(const shared_ptr<const GameNode>& node) {
+    bool hashed = node->hasStateHash();
+    uint64_t state_hash = 0;
+    if (hashed) {
+        state_hash = node->getStateHash();
+        auto it = state_nodes_.find(state_hash);
+        if (it != state_nodes_.end()) {
+            return it->second;
+        }
+    }
+
+    GameNode::Type type = node->getType();
+    size_t slot = 0;
+    vector<size_t> children;
+    const vector<double>* chance_probabilities = nullptr;
+
+    if (type == GameNode::Type::Terminal) {
+        const vector<double>& utilities = node->getTerminalUtilities();
+        if (n_players_ == 0) {
+            n_players_ = utilities.size();
+        } else if ((int) utilities.size() != n_players_) {
+            throw logic_error("Terminal nodes disagree on the number of players");
+        }
+        slot = utilities_.size();
+        utilities_.insert(utilities_.end(), utilities.begin(), utilities.end());
+    } else {
+        if (type == GameNode::Type::Chance) {
+            chance_probabilities = &node->getChanceProbabilities();
+        } else {
+            slot = getInfoSet(node);
+        }
+        // children first, postorder keeps them below the parent
+        for (int action : node->getLegalActions()) {
+            children.push_back(addNode(node->applyAction(action)));
+        }
+    }
+
+    size_t node_idx = node_type_.size();
+    node_type_.push_back(type);
+    node_slot_.push_back(slot);
+    node_first_edge_.push_back(edge_child_.size());
+    edge_child_.insert(edge_child_.end(), children.begin(), children.end());
+    if (chance_probabilities) {
+        edge_probability_.insert(
+            edge_probability_.end(), chance_probabilities->begin(), chance_probabilities->end()
+        );
+    } else {
+        edge_probability_.resize(edge_child_.size(), 0.0);
+    }
+
+    if (hashed) {
+        state_nodes_.emplace(state_hash, node_idx);
+    }
+    return node_idx;
+}
+
+template <InfoSetKey Key>
+vector<double> HeadToHead<Key>::collectStrategy(
+    const PolicyTable<Key>& policy, int player
+) const {
+    vector<double> probabilities(infoset_offsets_.back(), 0.0);
+    for (size_t infoset = 0; infoset < infoset_keys_.size(); infoset++) {
+        if (infoset_player_[infoset] != player) {
+            continue;
+        }
+        size_t offset = infoset_offsets_[infoset];
+        size_t n_actions = infoset_offsets_[infoset + 1] - offset;
+
+        size_t row = policy.findRow(infoset_keys_[infoset]);
+        if (row == PolicyTable<Key>::NOT_FOUND) {
+            if (missing_infoset_ == MissingInfoSet::Throw) {
+                throw out_of_range("InfoSet not found for key in strategy");
+            }
+            fill_n(probabilities.begin() + offset, n_actions, 1.0 / n_actions);
+            continue;
+        }
+
+        span<const double> strategy = policy.getRowStrategy(row);
+        if (strategy.size() != n_actions) {
+            throw invalid_argument("Strategy size does not match the number of legal actions");
+        }
+        copy(strategy.begin(), strategy.end(), probabilities.begin() + offset);
+    }
+    return probabilities;
+}
+
+template <InfoSetKey Key>
+vector<double> HeadToHead<Key>::sweep(
+    const vector<const vector<double>*>& player_probabilities
+) const {
+    size_t n_nodes = node_type_.size();
+    vector<double> values(n_nodes * n_players_);
+
+    for (size_t node = 0; node < n_nodes; node++) {
+        double* node_values = values.data() + node * n_players_;
+        if (node_type_[node] == GameNode::Type::Terminal) {
+            copy_n(utilities_.begin() + node_slot_[node], n_players_, node_values);
+            continue;
+        }
+
+        const double* strategy;
+        if (node_type_[node] == GameNode::Type::Chance) {
+            strategy = edge_probability_.data() + node_first_edge_[node];
+        } else {
+            size_t infoset = node_slot_[node];
+            strategy = player_probabilities[infoset_player_[infoset]]->data() +
+                infoset_offsets_[infoset];
+        }
+
+        fill_n(node_values, n_players_, 0.0);
+        for (size_t edge = node_first_edge_[node]; edge < node_first_edge_[node + 1]; edge++) {
+            const double* child_values = values.data() + edge_child_[edge] * n_players_;
+            double probability = strategy[edge - node_first_edge_[node]];
+            for (int p = 0; p < n_players_; p++) {
+                node_values[p] += probability * child_values[p];
+            }
+        }
+    }
+    // the root is added last
+    return vector<double>(values.end() - n_players_, values.end());
+}
+
+template <InfoSetKey Key>
+vector<double> HeadToHead<Key>::evaluate(const vector<Policy>& player_policies) const {
+    if ((int) player_policies.size() != n_players_) {
+        throw invalid_argument("Expected one policy per player");
+    }
+    vector<vector<double>> probabilities;
+    vector<const vector<double>*> player_probabilities;
+    probabilities.reserve(n_players_);
+    for (int p = 0; p < n_players_; p++) {
+        probabilities.push_back(collectStrategy(*player_policies[p], p));
+        player_probabilities.push_back(&probabilities.back());
+    }
+    return sweep(player_probabilities);
+}
+
+template <InfoSetKey Key>
+vector<vector<vector<double>>> HeadToHead<Key>::evaluateMatrix(
+    const vector<Policy>& policies, int n_threads
+) const {
+    if (n_players_ != 2) {
+        throw logic_error("evaluateMatrix requires a two-player game");
+    }
+    size_t n_policies = policies.size();
+
+    // every table is resolved against the info sets once and reused for all its games
+    vector<array<vector<double>, 2>> probabilities(n_policies);
+    cpp_utils::parallelFor(2 * n_policies, n_threads, [&](size_t k) {
+        probabilities[k / 2][k % 2] = collectStrategy(*policies[k / 2], k % 2);
+    });
+
+    vector<vector<vector<double>>> result(n_policies, vector<vector<double>>(n_policies));
+    cpp_utils::parallelFor(n_policies * n_policies, n_threads, [&](size_t pair) {
+        size_t i = pair / n_policies;
+        size_t j = pair % n_policies;
+        result[i][j] = sweep({&probabilities[i][0], &probabilities[j][1]});
+    });
+    return result;
+}
+
+template <InfoSetKey Key>
+int HeadToHead<Key>::getPlayerCount() const {
+    return n_players_;
+}
+
+template <InfoSetKey Key>
+size_t HeadToHead<Key>::getNodeCount() const {
+    return node_type_.size();
+}
+
+template <InfoSetKey Key>
+size_t HeadToHead<Key>::getInfoSetCount() const {
+    return infoset_keys_.size();
+}
+
+// Explicit instantiation definitions
+template class HeadToHead<string>;
+template class HeadToHead<size_t>;
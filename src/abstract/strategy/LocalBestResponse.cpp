@@ -0,0 +1,222 @@
+#include "abstract/strategy/LocalBestResponse.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+
+template <InfoSetKey Key>
+LocalBestResponse<Key>::LocalBestResponse(
+    shared_ptr<const GameNode> root,
+    shared_ptr<const PolicyTable<Key>> policy,
+    Params params,
+    MissingInfoSet missing_infoset
+) :
+    root_(root),
+    sampler_(policy),
+    params_(params),
+    missing_infoset_(missing_infoset)
+{
+    if (!root_) {
+        throw invalid_argument("Root node cannot be null");
+    }
+    if (params_.n_particles == 0 || params_.n_rollouts == 0) {
+        throw invalid_argument("n_particles and n_rollouts must be positive");
+    }
+}
+
+template <InfoSetKey Key>
+size_t LocalBestResponse<Key>::sampleActionIdx(
+    const GameNode& node, cpp_utils::CounterRng& rng
+) const {
+    const vector<int>& actions = node.getLegalActions();
+
+    if (node.getType() == GameNode::Type::Chance) {
+        return cpp_utils::sampleIndex(node.getChanceProbabilities(), rng.nextDouble());
+    }
+
+    size_t row = sampler_.getPolicyTable().findRow(node.getInfoSetKey<Key>());
+    if (row != PolicyTable<Key>::NOT_FOUND) {
+        if (sampler_.getPolicyTable().getRowStrategy(row).size() != actions.size()) {
+            throw logic_error("Strategy size does not match number of legal actions");
+        }
+        return sampler_.sampleRow(row, rng);
+    }
+    if (missing_infoset_ == MissingInfoSet::Uniform) {
+        return rng.nextIndex(actions.size());
+    }
+    throw out_of_range("InfoSet not found for key in strategy map");
+}
+
+template <InfoSetKey Key>
+shared_ptr<const GameNode> LocalBestResponse<Key>::advance(
+    shared_ptr<const GameNode> node, int exploiter, cpp_utils::CounterRng& rng
+) const {
+    while (node->getType() != GameNode::Type::Terminal &&
+           (node->getType() == GameNode::Type::Chance || node->getCurrentPlayer() != exploiter)) {
+        node = node->applyAction(node->getLegalActions()[sampleActionIdx(*node, rng)]);
+    }
+    return node;
+}
+
+template <InfoSetKey Key>
+double LocalBestResponse<Key>::rollout(
+    shared_ptr<const GameNode> node, int exploiter, cpp_utils::CounterRng& rng
+) const {
+    while (node->getType() != GameNode::Type::Terminal) {
+        node = node->applyAction(node->getLegalActions()[sampleActionIdx(*node, rng)]);
+    }
+    return node->getTerminalUtilities()[exploiter];
+}
+
+template <InfoSetKey Key>
+shared_ptr<const GameNode> LocalBestResponse<Key>::sampleHistory(
+    int exploiter, const vector<int>& exploiter_actions, const Key& key,
+    cpp_utils::CounterRng& rng
+) const {
+    shared_ptr<const GameNode> node = advance(root_, exploiter, rng);
+    for (int action : exploiter_actions) {
+        if (node->getType() == GameNode::Type::Terminal) {
+            return nullptr;
+        }
+        const vector<int>& actions = node->getLegalActions();
+        if (find(actions.begin(), actions.end(), action) == actions.end()) {
+            return nullptr;
+        }
+        node = advance(node->applyAction(action), exploiter, rng);
+    }
+    if (node->getType() != GameNode::Type::Decision || node->getInfoSetKey<Key>() != key) {
+        return nullptr;
+    }
+    return node;
+}
+
+template <InfoSetKey Key>
+double LocalBestResponse<Key>::playGame(
+    int exploiter, uint64_t seed, uint64_t game_idx, size_t* n_belief_failures
+) const {
+    // one stream per (game, exploiter), so both exploiters of a seed are independent
+    cpp_utils::CounterRng rng(seed, 2 * game_idx + (exploiter != 0));
+    shared_ptr<const GameNode> node = advance(root_, exploiter, rng);
+
+    vector<shared_ptr<const GameNode>> particles;
+    for (size_t i = 0; i < params_.n_particles; i++) {
+        particles.push_back(advance(root_, exploiter, rng));
+    }
+
+    vector<shared_ptr<const GameNode>> survivors;
+    vector<int> exploiter_actions;
+    while (node->getType() != GameNode::Type::Terminal) {
+        Key key = node->getInfoSetKey<Key>();
+        const vector<int>& actions = node->getLegalActions();
+
+        // condition the belief on the current info set
+        survivors.clear();
+        for (const auto& particle : particles) {
+            if (particle->getType() == GameNode::Type::Decision &&
+                particle->getInfoSetKey<Key>() == key) {
+                survivors.push_back(particle);
+            }
+        }
+        if (survivors.empty()) {
+            // the true history would give the exploiter hidden information
+            for (size_t i = 0; i < params_.n_resample_histories; i++) {
+                shared_ptr<const GameNode> history = sampleHistory(
+                    exploiter, exploiter_actions, key, rng
+                );
+                if (history) {
+                    survivors.push_back(history);
+                    if (survivors.size() == params_.n_particles) {
+                        break;
+                    }
+                }
+            }
+        }
+
+        size_t best_action_idx = 0;
+        if (survivors.empty()) {
+            // without a belief, play the policy, which only depends on the info set
+            if (n_belief_failures) {
+                (*n_belief_failures)++;
+            }
+            particles.clear();
+            best_action_idx = sampleActionIdx(*node, rng);
+        } else {
+            // resample back to full size, survivors are equally likely
+            particles.clear();
+            for (size_t i = 0; i < params_.n_particles; i++) {
+                particles.push_back(survivors[rng.nextIndex(survivors.size())]);
+            }
+
+            double best_value = -INFINITY;
+            for (size_t action_idx = 0; action_idx < actions.size(); action_idx++) {
+                double value = 0;
+                for (size_t r = 0; r < params_.n_rollouts; r++) {
+                    const auto& particle = particles[r % particles.size()];
+                    value += rollout(particle->applyAction(actions[action_idx]), exploiter, rng);
+                }
+                if (value > best_value) {
+                    best_value = value;
+                    best_action_idx = action_idx;
+                }
+            }
+        }
+
+        int action = actions[best_action_idx];
+        exploiter_actions.push_back(action);
+        node = advance(node->applyAction(action), exploiter, rng);
+        for (auto& particle : particles) {
+            particle = advance(particle->applyAction(action), exploiter, rng);
+        }
+    }
+    return node->getTerminalUtilities()[exploiter];
+}
+
+template <InfoSetKey Key>
+typename LocalBestResponse<Key>::Result LocalBestResponse<Key>::run(
+    int exploiter, size_t n_games, uint64_t seed, int n_threads
+) const {
+    size_t n_chunks = (n_games + GAMES_PER_CHUNK - 1) / GAMES_PER_CHUNK;
+    // chunks are played by one thread each
+    vector<size_t> chunk_failures(n_chunks, 0);
+    cpp_utils::SampleStatistics statistics = cpp_utils::sampleInChunks(
+        n_games, GAMES_PER_CHUNK, n_threads, [&](size_t game) {
+            return vector<double>{
+                playGame(exploiter, seed, game, &chunk_failures[game / GAMES_PER_CHUNK])
+            };
+        }
+    );
+
+    Result result = {exploiter, n_games, 0.0, 0.0, 0.0, 0};
+    for (size_t failures : chunk_failures) {
+        result.n_belief_failures += failures;
+    }
+    if (n_games > 0) {
+        result.mean_value = statistics.means[0];
+        result.standard_error = statistics.standard_errors[0];
+        result.confidence_95 = statistics.confidence_95[0];
+    }
+    return result;
+}
+
+template <InfoSetKey Key>
+typename LocalBestResponse<Key>::ExploitabilityEstimate
+LocalBestResponse<Key>::estimateExploitability(
+    size_t n_games, uint64_t seed, int n_threads
+) const {
+    ExploitabilityEstimate estimate;
+    for (int exploiter = 0; exploiter < 2; exploiter++) {
+        estimate.players.push_back(run(exploiter, n_games, seed, n_threads));
+    }
+    const Result& r0 = estimate.players[0];
+    const Result& r1 = estimate.players[1];
+    estimate.exploitability = (r0.mean_value + r1.mean_value) / 2;
+    // the two runs are independent
+    estimate.confidence_95 = 1.96 * sqrt(
+        r0.standard_error * r0.standard_error + r1.standard_error * r1.standard_error
+    ) / 2;
+    return estimate;
+}
+
+// Explicit instantiation definitions
+template class LocalBestResponse<string>;
+template class LocalBestResponse<size_t>;
@@ -0,0 +1,128 @@
+#include "abstract/strategy/PolicyTable.h"
+#include "Utils.h"
+#include <algorithm>
+#include <stdexcept>
+
+
+template <InfoSetKey Key>
+PolicyTable<Key>::PolicyTable(const InfoSetMap<Key>& infoset_map)
+    : max_actions_(0)
+{
+    rows_.reserve(infoset_map.size());
+    keys_.reserve(infoset_map.size());
+    offsets_.reserve(infoset_map.size() + 1);
+    offsets_.push_back(0);
+
+    for (const auto& [key, infoset] : infoset_map) {
+        const vector<double>& strategy_sum = infoset.getCumulativeStrategySum();
+
+        rows_.emplace(key, keys_.size());
+        keys_.push_back(key);
+
+        size_t offset = probabilities_.size();
+        probabilities_.resize(offset + strategy_sum.size());
+        strategy_utils::normalizeStrategyInto(
+            strategy_sum, span<double>(probabilities_).subspan(offset)
+        );
+        offsets_.push_back(probabilities_.size());
+        max_actions_ = max(max_actions_, strategy_sum.size());
+    }
+}
+
+template <InfoSetKey Key>
+size_t PolicyTable<Key>::size() const {
+    return keys_.size();
+}
+
+template <InfoSetKey Key>
+size_t PolicyTable<Key>::getMaxActions() const {
+    return max_actions_;
+}
+
+template <InfoSetKey Key>
+bool PolicyTable<Key>::contains(const Key& key) const {
+    return rows_.contains(key);
+}
+
+template <InfoSetKey Key>
+size_t PolicyTable<Key>::findRow(const Key& key) const {
+    auto it = rows_.find(key);
+    return it == rows_.end() ? NOT_FOUND : it->second;
+}
+
+template <InfoSetKey Key>
+span<const double> PolicyTable<Key>::getRowStrategy(size_t row) const {
+    return span<const double>(
+        probabilities_.data() + offsets_[row], offsets_[row + 1] - offsets_[row]
+    );
+}
+
+template <InfoSetKey Key>
+span<const double> PolicyTable<Key>::getStrategy(const Key& key) const {
+    size_t row = findRow(key);
+    if (row == NOT_FOUND) {
+        throw out_of_range("InfoSet not found for key in policy table");
+    }
+    return getRowStrategy(row);
+}
+
+template <InfoSetKey Key>
+void PolicyTable<Key>::findRows(span<const Key> keys, span<size_t> rows) const {
+    if (rows.size() < keys.size()) {
+        throw invalid_argument("Output buffer is smaller than the number of keys");
+    }
+    for (size_t i = 0; i < keys.size(); i++) {
+        rows[i] = findRow(keys[i]);
+    }
+}
+
+template <InfoSetKey Key>
+void PolicyTable<Key>::getStrategies(
+    span<const Key> keys,
+    span<double> out,
+    size_t row_width,
+    span<size_t> n_actions
+) const {
+    if (out.size() < keys.size() * row_width) {
+        throw invalid_argument("Output buffer is smaller than keys.size() * row_width");
+    }
+    if (!n_actions.empty() && n_actions.size() < keys.size()) {
+        throw invalid_argument("n_actions buffer is smaller than the number of keys");
+    }
+
+    for (size_t i = 0; i < keys.size(); i++) {
+        double* row_out = out.data() + i * row_width;
+        size_t row = findRow(keys[i]);
+
+        size_t n_copied = 0;
+        if (row != NOT_FOUND) {
+            span<const double> strategy = getRowStrategy(row);
+            n_copied = min(strategy.size(), row_width);
+            copy_n(strategy.begin(), n_copied, row_out);
+        }
+        fill(row_out + n_copied, row_out + row_width, 0.0);
+
+        if (!n_actions.empty()) {
+            n_actions[i] = (row == NOT_FOUND) ? 0 : offsets_[row + 1] - offsets_[row];
+        }
+    }
+}
+
+template <InfoSetKey Key>
+const vector<Key>& PolicyTable<Key>::getKeys() const {
+    return keys_;
+}
+
+template <InfoSetKey Key>
+const vector<size_t>& PolicyTable<Key>::getOffsets() const {
+    return offsets_;
+}
+
+template <InfoSetKey Key>
+const vector<double>& PolicyTable<Key>::getProbabilities() const {
+    return probabilities_;
+}
+
+// Explicit instantiation definitions
+template class PolicyTable<string>;
+template class PolicyTable<size_t>;
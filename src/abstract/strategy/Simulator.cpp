@@ -0,0 +1,80 @@
+#include "abstract/strategy/Simulator.h"
+#include <stdexcept>
+
+
+template <InfoSetKey Key>
+Simulator<Key>::Simulator(
+    shared_ptr<const GameNode> root,
+    const vector<shared_ptr<const PolicyTable<Key>>>& player_policies,
+    MissingInfoSet missing_infoset
+) :
+    root_(root),
+    missing_infoset_(missing_infoset)
+{
+    if (!root_) {
+        throw invalid_argument("Root node cannot be null");
+    }
+    // one sampler per distinct table
+    vector<const PolicyTable<Key>*> sampler_tables;
+    for (const auto& policy : player_policies) {
+        size_t sampler_idx = 0;
+        while (sampler_idx < sampler_tables.size() && sampler_tables[sampler_idx] != policy.get()) {
+            sampler_idx++;
+        }
+        if (sampler_idx == sampler_tables.size()) {
+            samplers_.emplace_back(policy);
+            sampler_tables.push_back(policy.get());
+        }
+        player_sampler_.push_back(sampler_idx);
+    }
+}
+
+template <InfoSetKey Key>
+vector<double> Simulator<Key>::playGame(uint64_t seed, uint64_t game_idx) const {
+    cpp_utils::CounterRng rng(seed, game_idx);
+    shared_ptr<const GameNode> node = root_;
+
+    while (node->getType() != GameNode::Type::Terminal) {
+        const vector<int>& actions = node->getLegalActions();
+        size_t action_idx = 0;
+
+        if (node->getType() == GameNode::Type::Chance) {
+            action_idx = cpp_utils::sampleIndex(node->getChanceProbabilities(), rng.nextDouble());
+        } else {
+            int player = node->getCurrentPlayer();
+            if (player < 0 || player >= (int) player_sampler_.size()) {
+                throw out_of_range("No policy for player " + to_string(player));
+            }
+            const ActionSampler<Key>& sampler = samplers_[player_sampler_[player]];
+            size_t row = sampler.getPolicyTable().findRow(node->getInfoSetKey<Key>());
+
+            if (row != PolicyTable<Key>::NOT_FOUND) {
+                if (sampler.getPolicyTable().getRowStrategy(row).size() != actions.size()) {
+                    throw logic_error("Strategy size does not match number of legal actions");
+                }
+                action_idx = sampler.sampleRow(row, rng);
+            } else if (missing_infoset_ == MissingInfoSet::Uniform) {
+                action_idx = rng.nextIndex(actions.size());
+            } else {
+                throw out_of_range("InfoSet not found for key in strategy map");
+            }
+        }
+        node = node->applyAction(actions[action_idx]);
+    }
+    return node->getTerminalUtilities();
+}
+
+template <InfoSetKey Key>
+typename Simulator<Key>::Result Simulator<Key>::run(
+    size_t n_games, uint64_t seed, int n_threads
+) const {
+    cpp_utils::SampleStatistics statistics = cpp_utils::sampleInChunks(
+        n_games, GAMES_PER_CHUNK, n_threads,
+        [&](size_t game) { return playGame(seed, game); }
+    );
+    return {n_games, statistics.means, statistics.standard_errors, statistics.confidence_95};
+}
+
+// Explicit instantiation definitions
+template class Simulator<string>;
+template class Simulator<size_t>;
@@ -1,5 +1,7 @@
 #include "cfr/CFRPlus.h"
-#include <iostream>
+#include <algorithm>
+#include <chrono>
+#include <mutex>
 #include <Utils.h>
 
 template<typename ISKey>
@@ -31,20 +33,73 @@ typename CFRPlus<ISKey>::Builder& CFRPlus<ISKey>::Builder::setInitialState(
     const InfoSetMap<ISKey>& initial_state
 ) {
     initial_state_ = initial_state;
+    shared_state_.reset();
     return *this;
 }
 
 template<typename ISKey>
-CFRPlus<ISKey> CFRPlus<ISKey>::Builder::buildCfr() {
-    if (!root_node_) {
-        throw std::invalid_argument("Root node cannot be null");
+typename CFRPlus<ISKey>::Builder& CFRPlus<ISKey>::Builder::setSharedState(
+    shared_ptr<InfoSetMap<ISKey>> shared_state
+) {
+    if (!shared_state) {
+        throw std::invalid_argument("Shared state cannot be null");
     }
-    return CFRPlus<ISKey>(
-        root_node_,
-        initial_evaluation_run_,
-        e_soft_regsum_strategies_,
-        initial_state_
-    );
+    shared_state_ = shared_state;
+    initial_state_ = InfoSetMap<ISKey>();
+    return *this;
+}
+
+template<typename ISKey>
+typename CFRPlus<ISKey>::Builder& CFRPlus<ISKey>::Builder::setPredictive(
+    bool predictive
+) {
+    predictive_ = predictive;
+    return *this;
+}
+
+template<typename ISKey>
+typename CFRPlus<ISKey>::Builder& CFRPlus<ISKey>::Builder::setChanceSampling(
+    bool chance_sampling
+) {
+    chance_sampling_ = chance_sampling;
+    return *this;
+}
+
+template<typename ISKey>
+typename CFRPlus<ISKey>::Builder& CFRPlus<ISKey>::Builder::setSeed(
+    uint64_t seed
+) {
+    seed_ = seed;
+    return *this;
+}
+
+template<typename ISKey>
+typename CFRPlus<ISKey>::Builder& CFRPlus<ISKey>::Builder::setParallel(
+    bool parallel
+) {
+    parallel_ = parallel;
+    return *this;
+}
+
+template<typename ISKey>
+typename CFRPlus<ISKey>::Builder& CFRPlus<ISKey>::Builder::setThreadCount(
+    int n_threads
+) {
+    n_threads_ = n_threads;
+    return *this;
+}
+
+template<typename ISKey>
+typename CFRPlus<ISKey>::Builder& CFRPlus<ISKey>::Builder::setInfoSetCapacityHint(
+    size_t infoset_capacity_hint
+) {
+    infoset_capacity_hint_ = infoset_capacity_hint;
+    return *this;
+}
+
+template<typename ISKey>
+CFRPlus<ISKey> CFRPlus<ISKey>::Builder::buildCfr() {
+    return CFRPlus<ISKey>(*this);
 }
 
 template<typename ISKey>
@@ -52,28 +107,68 @@ CFRPlus<ISKey>::CFRPlus(
     shared_ptr<const GameNode> root_node,
     bool inital_evaluation_run,
     double e_soft_regsum_strategies,
-    const InfoSetMap<ISKey>& initial_infosets
+    const InfoSetMap<ISKey>& initial_infosets,
+    bool predictive,
+    bool chance_sampling,
+    uint64_t seed,
+    bool parallel,
+    int n_threads,
+    size_t infoset_capacity_hint
 ):
-    root_node_(root_node),
-    infosets_(initial_infosets),
-    e_soft_regsum_strategies_(e_soft_regsum_strategies)
+    CFRPlus(Builder()
+        .setRootNode(root_node)
+        .setInitialEvaluationRun(inital_evaluation_run)
+        .setESoftRegsumStrategies(e_soft_regsum_strategies)
+        // the solver's own copy, setInitialState would copy it twice
+        .setSharedState(make_shared<InfoSetMap<ISKey>>(initial_infosets))
+        .setPredictive(predictive)
+        .setChanceSampling(chance_sampling)
+        .setSeed(seed)
+        .setParallel(parallel)
+        .setThreadCount(n_threads)
+        .setInfoSetCapacityHint(infoset_capacity_hint))
+{}
+
+template<typename ISKey>
+CFRPlus<ISKey>::CFRPlus(const Builder& builder):
+    root_node_(builder.root_node_),
+    // every solver built from a Builder gets its own copy of the initial state
+    infosets_(builder.shared_state_ ?
+        builder.shared_state_ : make_shared<InfoSetMap<ISKey>>(builder.initial_state_)),
+    e_soft_regsum_strategies_(builder.e_soft_regsum_strategies_),
+    predictive_(builder.predictive_),
+    iteration_(0),
+    n_created_infosets_(0),
+    all_infosets_created_(false),
+    chance_sampling_(builder.chance_sampling_),
+    rng_(builder.seed_),
+    parallel_(builder.parallel_),
+    n_threads_(builder.n_threads_),
+    work_depth_(0)
 {
-    if (infosets_.empty()) {
-        initInfoStates();
+    if (!root_node_) {
+        throw invalid_argument("Root node cannot be null");
+    }
+    if (parallel_ && chance_sampling_) {
+        throw invalid_argument("Chance sampling is not supported by parallel iterations");
     }
 
-    if (inital_evaluation_run) {
-        evaluateRegretSum();
+    if (builder.infoset_capacity_hint_ > 0) {
+        infosets_->reserve(builder.infoset_capacity_hint_);
+    }
+    // parallel iterations need dense ids for every info set before the first one
+    if (parallel_) {
+        initParallel();
+        all_infosets_created_ = true;
     }
-}
 
-template<typename ISKey>
-void CFRPlus<ISKey>::initInfoStates() {
-    initInfoStatesRecursively(root_node_);
+    if (builder.initial_evaluation_run_) {
+        evaluateRegretSum();
+    }
 }
 
 template<typename ISKey>
-void CFRPlus<ISKey>::initInfoStatesRecursively(const shared_ptr<const GameNode> node) {
+void CFRPlus<ISKey>::createInfoSets(const shared_ptr<const GameNode> node) {
     if (node->getType() == GameNode::Type::Terminal) {
         return;
     }
@@ -81,37 +176,126 @@ void CFRPlus<ISKey>::initInfoStatesRecursively(const shared_ptr<const GameNode>
     const vector<int>& actions = node->getLegalActions();
 
     if (node->getType() == GameNode::Type::Decision) {
-        ISKey infoset_key = getInfoSetKey(node);
-        infosets_.try_emplace(infoset_key, actions.size());
+        ISKey key = getInfoSetKey(node);
+        getInfoSet(key, actions.size());
+        if (parallel_ && infoset_ids_.emplace(key, infoset_keys_.size()).second) {
+            infoset_keys_.push_back(std::move(key));
+            infoset_offsets_.push_back(infoset_offsets_.back() + actions.size());
+        }
     }
 
     for (int action : actions) {
-        initInfoStatesRecursively(node->applyAction(action));
+        createInfoSets(node->applyAction(action));
+    }
+}
+
+template<typename ISKey>
+InfoSet& CFRPlus<ISKey>::getInfoSet(const ISKey& infoset_key, size_t n_actions) {
+    bool inserted = false;
+    InfoSet& infoset = infoset_utils::findOrAddInfoSet(*infosets_, infoset_key, n_actions, &inserted);
+    if (inserted) {
+        n_created_infosets_++;
     }
+    return infoset;
 }
 
 template<typename ISKey>
 const InfoSetMap<ISKey>& CFRPlus<ISKey>::getStrategyInfoSets() {
+    // chance sampling or no traversal yet leave info sets uncreated
+    if (!all_infosets_created_) {
+        createInfoSets(root_node_);
+        all_infosets_created_ = true;
+    }
+    return *infosets_;
+}
+
+template<typename ISKey>
+shared_ptr<InfoSetMap<ISKey>> CFRPlus<ISKey>::getSharedInfoSets() {
     return infosets_;
 }
 
+template<typename ISKey>
+size_t CFRPlus<ISKey>::getCreatedInfoSetCount() const {
+    return n_created_infosets_;
+}
+
+template<typename ISKey>
+const vector<double>& CFRPlus<ISKey>::getRootOutcomeValues() const {
+    return root_outcome_values_;
+}
+
 template<typename ISKey>
 double CFRPlus<ISKey>::evaluateAndUpdateRegretSum(
     bool accumulate_regsum,
     bool accumulate_strategy
 ) {
-    return this->processNode(
-        root_node_, 1, 1, 1, accumulate_regsum, accumulate_strategy
-    );
+    double value = parallel_ ?
+        runParallelIteration(accumulate_regsum, accumulate_strategy) :
+        this->processNode(
+            root_node_, 1, 1, 1, accumulate_regsum, accumulate_strategy
+        );
+    if (accumulate_regsum) {
+        iteration_++;
+    }
+    // see processChanceNode
+    if (!chance_sampling_ || (!accumulate_regsum && !accumulate_strategy)) {
+        all_infosets_created_ = true;
+    }
+    return value;
 }
 
 template<typename ISKey>
 double CFRPlus<ISKey>::evaluateRegretSum() {
     bool accumulate_regsum = false;
     bool accumulate_strategy = false;
-    return this->processNode(
+    if (parallel_) {
+        return runParallelIteration(accumulate_regsum, accumulate_strategy);
+    }
+    double value = this->processNode(
         root_node_, 1, 1, 1, accumulate_regsum, accumulate_strategy
     );
+    all_infosets_created_ = true;
+    return value;
+}
+
+template<typename ISKey>
+int CFRPlus<ISKey>::train(
+    int n_iterations,
+    int strategy_delay,
+    const ProgressCallback& callback,
+    double callback_interval_seconds,
+    stop_token stop
+) {
+    using clock = chrono::steady_clock;
+    auto callback_interval = chrono::duration_cast<clock::duration>(
+        chrono::duration<double>(callback_interval_seconds)
+    );
+    auto last_callback = clock::now();
+
+    int iteration = 0;
+    while (iteration < n_iterations && !stop.stop_requested()) {
+        double root_value = evaluateAndUpdateRegretSum(
+            true, iteration >= strategy_delay
+        );
+        iteration++;
+
+        if (!callback) {
+            continue;
+        }
+        // metric is only computed when the callback actually fires
+        auto now = clock::now();
+        if (now - last_callback >= callback_interval || iteration == n_iterations) {
+            last_callback = now;
+            TrainingProgress progress = {
+                iteration, n_iterations, root_value,
+                infoset_utils::calculateMetric(*infosets_)
+            };
+            if (!callback(progress)) {
+                break;
+            }
+        }
+    }
+    return iteration;
 }
 
 template<typename ISKey>
@@ -173,10 +357,20 @@ double CFRPlus<ISKey>::processDecisionNode(
     
     const ISKey& infoset_key = getInfoSetKey(node);
 
-    InfoSet& infoset = infosets_.at(infoset_key);
+    // created on the first visit, references survive rehashing
+    InfoSet& infoset = getInfoSet(infoset_key, n_available_actions);
     
+    vector<double> regretsum_strategy;
+    if (predictive_) {
+        infoset.startIteration(iteration_);
+        regretsum_strategy = infoset.getPredictiveStrategy();
+    } else {
+        regretsum_strategy = infoset.getRegretSumStrategy();
+    }
+    // strategy that is accumulated for the predictive variant
+    const vector<double> played_strategy = predictive_ ? regretsum_strategy : vector<double>();
+
     // e_soft strategy to add weight to "impossible" events - experimental
-    vector<double> regretsum_strategy = infoset.getRegretSumStrategy();
     if (e_soft_regsum_strategies_ > 0) {
         regretsum_strategy = \
             strategy_utils::epsilonSoftStrategy(
@@ -219,40 +413,37 @@ double CFRPlus<ISKey>::processDecisionNode(
             regretsum_strategy[action_idx] * action_utilities[action_idx];
     }
 
+    vector<double> instant_regrets(n_available_actions);
+    cfr_utils::computeInstantRegrets(
+        node->getCurrentPlayer(), action_utilities, regretsum_strategy_utility, instant_regrets
+    );
     for (int action_idx = 0; action_idx < n_available_actions; action_idx++) {
-        double new_regret = (
-            action_utilities[action_idx] - regretsum_strategy_utility
-        );
-        if (node->getCurrentPlayer() == 1) {
-            // default returned value is for player 0
-            // invert value for player 1
-            new_regret = -new_regret;
-        }
-        infoset.setInstantRegret(action_idx, new_regret);
+        infoset.setInstantRegret(action_idx, instant_regrets[action_idx]);
     }
 
     if (accumulate_regsum || accumulate_strategy) {
-        double regret_weight = 0;
-        double cum_strategy_weight = 0;
-        // regret weight takes probability excluding current player's past  actions
+        // regret weight takes probability excluding current player's past actions
         // cum strategy weight, conversely, takes current player's actions probabilities
-        if (node->getCurrentPlayer() == 0) {
-            regret_weight = p_past_chances * p_past_actions_p1;
-            cum_strategy_weight = p_past_actions_p0;
-        }
-        if (node->getCurrentPlayer() == 1) {
-            regret_weight = p_past_chances * p_past_actions_p0;
-            cum_strategy_weight = p_past_actions_p1;
-        }
+        cfr_utils::UpdateWeights weights = cfr_utils::getUpdateWeights(
+            node->getCurrentPlayer(), p_past_actions_p0, p_past_actions_p1, p_past_chances
+        );
 
         if (accumulate_regsum) {
-            infoset.accumulateRegret(regret_weight);
+            if (predictive_) {
+                infoset.accumulatePredictiveRegret(weights.regret);
+            } else {
+                infoset.accumulateRegret(weights.regret);
+            }
         }
         if (accumulate_strategy) {
             // use non-soft strategy here to accumulate the correct final strategy
             // softness is used to achieve non-zero regrets for "impossible" events
             // but it should be excluded from the final result 
-            infoset.accumulateStrategy(cum_strategy_weight);
+            if (predictive_) {
+                infoset.accumulateStrategy(weights.strategy, played_strategy);
+            } else {
+                infoset.accumulateStrategy(weights.strategy);
+            }
         }
     }
 
@@ -271,9 +462,23 @@ double CFRPlus<ISKey>::processChanceNode(
 ) {
     const vector<int>& available_actions = node->getLegalActions();
     int n_available_actions = available_actions.size();
+    const vector<double>& chance_probs = node->getChanceProbabilities();
+
+    if (chance_sampling_ && (accumulate_regsum || accumulate_strategy)) {
+        // outcome is sampled with its chance probability, so p_past_chances
+        // is multiplied by p / p and the child value is an unbiased estimate
+        size_t sampled_idx = cpp_utils::sampleIndex(chance_probs, rng_.nextDouble());
+        return processNode(
+            node->applyAction(available_actions[sampled_idx]),
+            p_past_actions_p0,
+            p_past_actions_p1,
+            p_past_chances,
+            accumulate_regsum,
+            accumulate_strategy
+        );
+    }
 
     vector<double> action_utilities(n_available_actions, 0);
-    vector<double> chance_probs = node->getChanceProbabilities();
 
     for (int action_idx = 0; action_idx < n_available_actions; action_idx++) {
         shared_ptr<const GameNode> next_node = \
@@ -295,6 +500,9 @@ double CFRPlus<ISKey>::processChanceNode(
         chance_node_utility += \
             chance_probs[action_idx] * action_utilities[action_idx];
     }
+    if (node == root_node_) {
+        root_outcome_values_ = action_utilities;
+    }
     return chance_node_utility;  
 }
 
@@ -306,6 +514,292 @@ double CFRPlus<ISKey>::processTerminalNode(
     return node->getTerminalUtilities()[0];
 }
 
+
+template<typename ISKey>
+void CFRPlus<ISKey>::initParallel() {
+    // only info sets below the root get ids, a shared map may hold others
+    infoset_offsets_.push_back(0);
+    createInfoSets(root_node_);
+    strategies_.resize(infoset_offsets_.back());
+    played_strategies_.resize(infoset_offsets_.back());
+
+    // smallest depth with enough nodes to keep all threads busy
+    vector<shared_ptr<const GameNode>> level = {root_node_};
+    while (level.size() < MIN_WORK_ITEMS) {
+        vector<shared_ptr<const GameNode>> next_level;
+        for (const auto& node : level) {
+            if (node->getType() == GameNode::Type::Terminal) {
+                continue;
+            }
+            for (int action : node->getLegalActions()) {
+                next_level.push_back(node->applyAction(action));
+            }
+        }
+        if (next_level.empty()) {
+            break;
+        }
+        level = std::move(next_level);
+        work_depth_++;
+    }
+}
+
+template<typename ISKey>
+double CFRPlus<ISKey>::runParallelIteration(
+    bool accumulate_regsum,
+    bool accumulate_strategy
+) {
+    size_t n_infosets = infoset_keys_.size();
+
+    // strategies stay fixed for the whole iteration,
+    // every info set is written by exactly one index
+    cpp_utils::parallelFor(n_infosets, n_threads_, [&](size_t id) {
+        InfoSet& infoset = infosets_->at(infoset_keys_[id]);
+        vector<double> strategy;
+        if (predictive_) {
+            infoset.startIteration(iteration_);
+            strategy = infoset.getPredictiveStrategy();
+        } else {
+            strategy = const_cast<const InfoSet&>(infoset).getRegretSumStrategy();
+        }
+        copy(strategy.begin(), strategy.end(), played_strategies_.begin() + infoset_offsets_[id]);
+        if (e_soft_regsum_strategies_ > 0) {
+            strategy = strategy_utils::epsilonSoftStrategy(e_soft_regsum_strategies_, strategy);
+        }
+        copy(strategy.begin(), strategy.end(), strategies_.begin() + infoset_offsets_[id]);
+    });
+
+    auto makeBuffer = [&]() {
+        auto buffer = make_unique<ReductionBuffer>();
+        buffer->regrets.assign(infoset_offsets_.back(), 0.0);
+        if (accumulate_strategy) {
+            buffer->strategies.assign(infoset_offsets_.back(), 0.0);
+        }
+        buffer->is_touched.assign(n_infosets, 0);
+        return buffer;
+    };
+
+    // the prefix is walked once to find the work items and their reach
+    unique_ptr<ReductionBuffer> prefix_buffer = makeBuffer();
+    work_items_.clear();
+    size_t next_item = 0;
+    processBufferedNode(
+        root_node_, 0, 1, 1, 1, accumulate_strategy, *prefix_buffer,
+        PrefixPass::CollectItems, next_item
+    );
+
+    // one dense buffer per running thread, handed over between work items
+    vector<PartialSums> partials(work_items_.size() + 1);
+    vector<unique_ptr<ReductionBuffer>> free_buffers;
+    mutex buffers_mutex;
+    cpp_utils::parallelFor(work_items_.size(), n_threads_, [&](size_t item_idx) {
+        unique_ptr<ReductionBuffer> buffer;
+        {
+            lock_guard<mutex> lock(buffers_mutex);
+            if (!free_buffers.empty()) {
+                buffer = std::move(free_buffers.back());
+                free_buffers.pop_back();
+            }
+        }
+        if (!buffer) {
+            buffer = makeBuffer();
+        }
+
+        WorkItem& item = work_items_[item_idx];
+        size_t unused_item = 0;
+        item.value = processBufferedNode(
+            item.node,
+            work_depth_,
+            item.p_past_actions_p0,
+            item.p_past_actions_p1,
+            item.p_past_chances,
+            accumulate_strategy,
+            *buffer,
+            PrefixPass::None,
+            unused_item
+        );
+        extractPartialSums(*buffer, partials[item_idx]);
+
+        lock_guard<mutex> lock(buffers_mutex);
+        free_buffers.push_back(std::move(buffer));
+    });
+
+    // the prefix is walked again with the values of the work items
+    next_item = 0;
+    double value = processBufferedNode(
+        root_node_, 0, 1, 1, 1, accumulate_strategy, *prefix_buffer,
+        PrefixPass::UseItems, next_item
+    );
+    extractPartialSums(*prefix_buffer, partials.back());
+
+    // fixed reduction order: work items in traversal order, then the prefix
+    vector<double> regret_totals(infoset_offsets_.back(), 0.0);
+    vector<double> strategy_totals(accumulate_strategy ? infoset_offsets_.back() : 0, 0.0);
+    for (const PartialSums& partial : partials) {
+        size_t position = 0;
+        for (size_t id : partial.ids) {
+            for (size_t i = infoset_offsets_[id]; i < infoset_offsets_[id + 1]; i++, position++) {
+                regret_totals[i] += partial.regrets[position];
+                if (accumulate_strategy) {
+                    strategy_totals[i] += partial.strategies[position];
+                }
+            }
+        }
+    }
+
+    // totals are already weighted, instant regret is the iteration's regret
+    cpp_utils::parallelFor(n_infosets, n_threads_, [&](size_t id) {
+        InfoSet& infoset = infosets_->at(infoset_keys_[id]);
+        size_t offset = infoset_offsets_[id];
+        size_t n_actions = infoset_offsets_[id + 1] - offset;
+        for (size_t action_idx = 0; action_idx < n_actions; action_idx++) {
+            infoset.setInstantRegret(action_idx, regret_totals[offset + action_idx]);
+        }
+        if (accumulate_regsum) {
+            if (predictive_) {
+                infoset.accumulatePredictiveRegret(1.0);
+            } else {
+                infoset.accumulateRegret(1.0);
+            }
+        }
+        if (accumulate_strategy) {
+            infoset.accumulateStrategy(1.0, vector<double>(
+                strategy_totals.begin() + offset, strategy_totals.begin() + offset + n_actions
+            ));
+        }
+    });
+
+    return value;
+}
+
+template<typename ISKey>
+double CFRPlus<ISKey>::processBufferedNode(
+    const shared_ptr<const GameNode>& node,
+    int depth,
+    double p_past_actions_p0,
+    double p_past_actions_p1,
+    double p_past_chances,
+    bool accumulate_strategy,
+    ReductionBuffer& buffer,
+    PrefixPass pass,
+    size_t& next_item
+) {
+    if (pass != PrefixPass::None && depth == work_depth_) {
+        if (pass == PrefixPass::CollectItems) {
+            work_items_.push_back({node, p_past_actions_p0, p_past_actions_p1, p_past_chances, 0});
+            return 0;
+        }
+        return work_items_[next_item++].value;
+    }
+
+    switch (node->getType()) {
+    case GameNode::Type::Terminal:
+        return processTerminalNode(node);
+
+    case GameNode::Type::Chance: {
+        const vector<int>& available_actions = node->getLegalActions();
+        const vector<double>& chance_probs = node->getChanceProbabilities();
+        // only one thread is at depth 0, the values of the UseItems pass are the final ones
+        if (depth == 0) {
+            root_outcome_values_.assign(available_actions.size(), 0);
+        }
+        double chance_node_utility = 0;
+        for (size_t action_idx = 0; action_idx < available_actions.size(); action_idx++) {
+            double outcome_utility = processBufferedNode(
+                node->applyAction(available_actions[action_idx]),
+                depth + 1,
+                p_past_actions_p0,
+                p_past_actions_p1,
+                p_past_chances * chance_probs[action_idx],
+                accumulate_strategy,
+                buffer,
+                pass,
+                next_item
+            );
+            if (depth == 0) {
+                root_outcome_values_[action_idx] = outcome_utility;
+            }
+            chance_node_utility += chance_probs[action_idx] * outcome_utility;
+        }
+        return chance_node_utility;
+    }
+
+    case GameNode::Type::Decision:
+        break;
+
+    default:
+        throw logic_error("Unexpected type");
+    }
+
+    const vector<int>& available_actions = node->getLegalActions();
+    size_t n_available_actions = available_actions.size();
+    int player = node->getCurrentPlayer();
+    size_t id = infoset_ids_.at(getInfoSetKey(node));
+    size_t offset = infoset_offsets_[id];
+    const double* strategy = strategies_.data() + offset;
+
+    vector<double> action_utilities(n_available_actions);
+    double regretsum_strategy_utility = 0;
+    for (size_t action_idx = 0; action_idx < n_available_actions; action_idx++) {
+        action_utilities[action_idx] = processBufferedNode(
+            node->applyAction(available_actions[action_idx]),
+            depth + 1,
+            player == 0 ? p_past_actions_p0 * strategy[action_idx] : p_past_actions_p0,
+            player == 1 ? p_past_actions_p1 * strategy[action_idx] : p_past_actions_p1,
+            p_past_chances,
+            accumulate_strategy,
+            buffer,
+            pass,
+            next_item
+        );
+        regretsum_strategy_utility += strategy[action_idx] * action_utilities[action_idx];
+    }
+    if (pass == PrefixPass::CollectItems) {
+        return 0;
+    }
+
+    // same update as processDecisionNode, summed instead of applied
+    if (!buffer.is_touched[id]) {
+        buffer.is_touched[id] = 1;
+        buffer.touched_ids.push_back(id);
+    }
+    cfr_utils::UpdateWeights weights = cfr_utils::getUpdateWeights(
+        player, p_past_actions_p0, p_past_actions_p1, p_past_chances
+    );
+    vector<double> instant_regrets(n_available_actions);
+    cfr_utils::computeInstantRegrets(player, action_utilities, regretsum_strategy_utility, instant_regrets);
+    cfr_utils::accumulateWeighted(
+        span(buffer.regrets).subspan(offset, n_available_actions), weights.regret, instant_regrets
+    );
+    if (accumulate_strategy) {
+        cfr_utils::accumulateWeighted(
+            span(buffer.strategies).subspan(offset, n_available_actions),
+            weights.strategy,
+            span(played_strategies_).subspan(offset, n_available_actions)
+        );
+    }
+    return regretsum_strategy_utility;
+}
+
+template<typename ISKey>
+void CFRPlus<ISKey>::extractPartialSums(ReductionBuffer& buffer, PartialSums& partial) const {
+    // each id appears once per partial, so its order does not affect the sums
+    sort(buffer.touched_ids.begin(), buffer.touched_ids.end());
+    partial.ids = buffer.touched_ids;
+    bool with_strategies = !buffer.strategies.empty();
+    for (size_t id : buffer.touched_ids) {
+        for (size_t i = infoset_offsets_[id]; i < infoset_offsets_[id + 1]; i++) {
+            partial.regrets.push_back(buffer.regrets[i]);
+            buffer.regrets[i] = 0;
+            if (with_strategies) {
+                partial.strategies.push_back(buffer.strategies[i]);
+                buffer.strategies[i] = 0;
+            }
+        }
+        buffer.is_touched[id] = 0;
+    }
+    buffer.touched_ids.clear();
+}
+
 // Explicit instantiation definitions - this generates the actual code
 template class CFRPlus<string>;
 template class CFRPlus<size_t>;
@@ -0,0 +1,116 @@
+#include "cfr/HogwildMCCFR.h"
+#include <stdexcept>
+
+
+template <InfoSetKey Key>
+HogwildMCCFR<Key>::HogwildMCCFR(
+    shared_ptr<const GameNode> root_node,
+    size_t infoset_capacity,
+    uint64_t seed
+) :
+    root_node_(root_node),
+    table_(infoset_capacity),
+    seed_(seed),
+    n_players_(0),
+    n_iterations_(0)
+{
+    if (!root_node_) {
+        throw invalid_argument("Root node cannot be null");
+    }
+
+    // number of players is the size of the utilities of any terminal node
+    shared_ptr<const GameNode> node = root_node_;
+    while (node->getType() != GameNode::Type::Terminal) {
+        node = node->applyAction(node->getLegalActions().front());
+    }
+    n_players_ = node->getTerminalUtilities().size();
+}
+
+template <InfoSetKey Key>
+void HogwildMCCFR<Key>::train(int n_iterations, int n_threads) {
+    if (n_iterations <= 0) {
+        return;
+    }
+    // every iteration has its own random stream, independent of the thread running it
+    int first_iteration = n_iterations_;
+    cpp_utils::parallelFor(n_iterations, n_threads, [&](size_t i) {
+        cpp_utils::CounterRng rng(seed_, first_iteration + i);
+        for (int traverser = 0; traverser < n_players_; traverser++) {
+            traverse(root_node_, traverser, rng);
+        }
+    });
+    n_iterations_ += n_iterations;
+}
+
+template <InfoSetKey Key>
+double HogwildMCCFR<Key>::traverse(
+    const shared_ptr<const GameNode>& node,
+    int traverser,
+    cpp_utils::CounterRng& rng
+) {
+    switch (node->getType()) {
+    case GameNode::Type::Terminal:
+        return node->getTerminalUtilities()[traverser];
+
+    case GameNode::Type::Chance: {
+        size_t outcome_idx = cpp_utils::sampleIndex(node->getChanceProbabilities(), rng.nextDouble());
+        return traverse(node->applyAction(node->getLegalActions()[outcome_idx]), traverser, rng);
+    }
+
+    case GameNode::Type::Decision:
+        break;
+
+    default:
+        throw logic_error("Unexpected type");
+    }
+
+    const vector<int>& actions = node->getLegalActions();
+    size_t n_actions = actions.size();
+    auto& entry = table_.findOrInsert(node->getInfoSetKey<Key>(), n_actions);
+
+    vector<double> strategy(n_actions);
+    entry.getRegretSumStrategy(strategy);
+
+    if (node->getCurrentPlayer() != traverser) {
+        entry.accumulateStrategy(1.0, strategy);
+        size_t action_idx = cpp_utils::sampleIndex(strategy, rng.nextDouble());
+        return traverse(node->applyAction(actions[action_idx]), traverser, rng);
+    }
+
+    vector<double> action_values(n_actions);
+    double value = 0;
+    for (size_t action_idx = 0; action_idx < n_actions; action_idx++) {
+        action_values[action_idx] = traverse(node->applyAction(actions[action_idx]), traverser, rng);
+        value += strategy[action_idx] * action_values[action_idx];
+    }
+    // sampled values are already weighted by the opponents' and chance's reach
+    for (size_t action_idx = 0; action_idx < n_actions; action_idx++) {
+        action_values[action_idx] -= value;
+    }
+    entry.accumulateRegret(1.0, action_values);
+    return value;
+}
+
+template <InfoSetKey Key>
+int HogwildMCCFR<Key>::getIterationCount() const {
+    return n_iterations_;
+}
+
+template <InfoSetKey Key>
+int HogwildMCCFR<Key>::getPlayerCount() const {
+    return n_players_;
+}
+
+template <InfoSetKey Key>
+const ConcurrentInfoSetTable<Key>& HogwildMCCFR<Key>::getTable() const {
+    return table_;
+}
+
+template <InfoSetKey Key>
+InfoSetMap<Key> HogwildMCCFR<Key>::getStrategyInfoSets() const {
+    return table_.toInfoSetMap();
+}
+
+// Explicit instantiation definitions
+template class HogwildMCCFR<string>;
+template class HogwildMCCFR<size_t>;
@@ -0,0 +1,66 @@
+#include "cfr/MultiRootCFR.h"
+
+
+template <InfoSetKey Key>
+MultiRootCFR<Key>::MultiRootCFR(
+    const vector<shared_ptr<const GameNode>>& roots,
+    const vector<double>& weights,
+    int n_threads,
+    shared_ptr<InfoSetMap<Key>> shared_state
+) :
+    root_node_(make_shared<MultiRootNode>(roots, weights)),
+    cfr_(
+        typename CFRPlus<Key>::Builder()
+            .setRootNode(root_node_)
+            .setSharedState(shared_state ? shared_state : make_shared<InfoSetMap<Key>>())
+            .setInitialEvaluationRun(false)
+            .setParallel(true)
+            .setThreadCount(n_threads)
+            .buildCfr()
+    ),
+    weighted_value_(0)
+{}
+
+template <InfoSetKey Key>
+vector<double> MultiRootCFR<Key>::evaluateAndUpdateRegretSum(
+    bool accumulate_regsum,
+    bool accumulate_strategy
+) {
+    weighted_value_ = cfr_.evaluateAndUpdateRegretSum(accumulate_regsum, accumulate_strategy);
+    return cfr_.getRootOutcomeValues();
+}
+
+template <InfoSetKey Key>
+vector<double> MultiRootCFR<Key>::evaluateRegretSum() {
+    weighted_value_ = cfr_.evaluateRegretSum();
+    return cfr_.getRootOutcomeValues();
+}
+
+template <InfoSetKey Key>
+size_t MultiRootCFR<Key>::getRootCount() const {
+    return root_node_->getRootCount();
+}
+
+template <InfoSetKey Key>
+double MultiRootCFR<Key>::getWeightedValue() const {
+    return weighted_value_;
+}
+
+template <InfoSetKey Key>
+const InfoSetMap<Key>& MultiRootCFR<Key>::getStrategyInfoSets() {
+    return cfr_.getStrategyInfoSets();
+}
+
+template <InfoSetKey Key>
+shared_ptr<InfoSetMap<Key>> MultiRootCFR<Key>::getSharedInfoSets() {
+    return cfr_.getSharedInfoSets();
+}
+
+template <InfoSetKey Key>
+CFRPlus<Key>& MultiRootCFR<Key>::getSolver() {
+    return cfr_;
+}
+
+// Explicit instantiation definitions
+template class MultiRootCFR<string>;
+template class MultiRootCFR<size_t>;
@@ -0,0 +1,165 @@
+#include "cfr/OutOfCoreCFR.h"
+#include "abstract/infoset/InfoSet.h"
+#include "abstract/infoset/InfoSetUtils.h"
+#include "Utils.h"
+#include <stdexcept>
+
+
+template <InfoSetKey Key>
+OutOfCoreCFR<Key>::OutOfCoreCFR(
+    shared_ptr<const GameNode> root_node,
+    const typename InfoSetStore<Key>::Params& store_params,
+    InfoSetMap<Key> initial_state
+) :
+    root_node_(root_node),
+    store_(store_params),
+    initial_state_(std::move(initial_state))
+{
+    if (!root_node_) {
+        throw invalid_argument("Root node cannot be null");
+    }
+}
+
+template <InfoSetKey Key>
+size_t OutOfCoreCFR<Key>::getInfoSetId(const Key& key, size_t n_actions) {
+    size_t id = store_.find(key);
+    if (id != InfoSetStore<Key>::NOT_FOUND) {
+        return id;
+    }
+
+    auto it = initial_state_.find(key);
+    // same initial sums as a new InfoSet
+    InfoSet infoset = it != initial_state_.end() ? it->second : InfoSet(n_actions);
+    if (infoset.getRegretSum().size() != n_actions) {
+        throw logic_error(
+            "Info set " + infoset_utils::convertKey<Key, string>(key) + " has " +
+            to_string(infoset.getRegretSum().size()) + " actions, its node has " +
+            to_string(n_actions)
+        );
+    }
+    id = store_.insert(key, infoset.getRegretSum(), infoset.getCumulativeStrategySum());
+    if (it != initial_state_.end()) {
+        initial_state_.erase(it);
+    }
+    return id;
+}
+
+template <InfoSetKey Key>
+double OutOfCoreCFR<Key>::evaluateAndUpdateRegretSum(
+    bool accumulate_regsum,
+    bool accumulate_strategy
+) {
+    double value = processNode(root_node_, 1, 1, 1, accumulate_regsum, accumulate_strategy);
+    // every traversal is full width, the remaining entries are never visited
+    InfoSetMap<Key>().swap(initial_state_);
+    return value;
+}
+
+template <InfoSetKey Key>
+double OutOfCoreCFR<Key>::evaluateRegretSum() {
+    return evaluateAndUpdateRegretSum(false, false);
+}
+
+template <InfoSetKey Key>
+double OutOfCoreCFR<Key>::processNode(
+    const shared_ptr<const GameNode>& node,
+    double p_past_actions_p0,
+    double p_past_actions_p1,
+    double p_past_chances,
+    bool accumulate_regsum,
+    bool accumulate_strategy
+) {
+    switch (node->getType()) {
+    case GameNode::Type::Terminal:
+        return node->getTerminalUtilities()[0];
+
+    case GameNode::Type::Chance: {
+        const vector<int>& actions = node->getLegalActions();
+        const vector<double>& chance_probs = node->getChanceProbabilities();
+        vector<double> action_utilities(actions.size());
+        for (size_t action_idx = 0; action_idx < actions.size(); action_idx++) {
+            action_utilities[action_idx] = processNode(
+                node->applyAction(actions[action_idx]),
+                p_past_actions_p0,
+                p_past_actions_p1,
+                p_past_chances * chance_probs[action_idx],
+                accumulate_regsum,
+                accumulate_strategy
+            );
+        }
+        double chance_node_utility = 0;
+        for (size_t action_idx = 0; action_idx < actions.size(); action_idx++) {
+            chance_node_utility += chance_probs[action_idx] * action_utilities[action_idx];
+        }
+        return chance_node_utility;
+    }
+
+    case GameNode::Type::Decision:
+        break;
+
+    default:
+        throw logic_error("Unexpected type");
+    }
+
+    const vector<int>& actions = node->getLegalActions();
+    size_t n_actions = actions.size();
+    int player = node->getCurrentPlayer();
+    size_t id = getInfoSetId(node->getInfoSetKey<Key>(), n_actions);
+
+    vector<double> regretsum_strategy(n_actions);
+    strategy_utils::normalizeStrategyInto(store_.getRegretSum(id), regretsum_strategy);
+
+    vector<double> action_utilities(n_actions);
+    for (size_t action_idx = 0; action_idx < n_actions; action_idx++) {
+        action_utilities[action_idx] = processNode(
+            node->applyAction(actions[action_idx]),
+            player == 0 ? p_past_actions_p0 * regretsum_strategy[action_idx] : p_past_actions_p0,
+            player == 1 ? p_past_actions_p1 * regretsum_strategy[action_idx] : p_past_actions_p1,
+            p_past_chances,
+            accumulate_regsum,
+            accumulate_strategy
+        );
+    }
+
+    double regretsum_strategy_utility = 0;
+    for (size_t action_idx = 0; action_idx < n_actions; action_idx++) {
+        regretsum_strategy_utility += regretsum_strategy[action_idx] * action_utilities[action_idx];
+    }
+    if (!accumulate_regsum && !accumulate_strategy) {
+        return regretsum_strategy_utility;
+    }
+
+    cfr_utils::UpdateWeights weights = cfr_utils::getUpdateWeights(
+        player, p_past_actions_p0, p_past_actions_p1, p_past_chances
+    );
+    // the record is fetched again, the subtree may have spilled it
+    span<double> regret_sum = store_.getRegretSum(id);
+    if (accumulate_regsum) {
+        vector<double> instant_regrets(n_actions);
+        cfr_utils::computeInstantRegrets(player, action_utilities, regretsum_strategy_utility, instant_regrets);
+        cfr_utils::accumulatePositiveRegret(regret_sum, weights.regret, instant_regrets);
+    }
+    if (accumulate_strategy) {
+        // CFRPlus accumulates the regret sum strategy after this visit's update
+        vector<double> strategy = regretsum_strategy;
+        if (accumulate_regsum) {
+            strategy_utils::normalizeStrategyInto(regret_sum, strategy);
+        }
+        cfr_utils::accumulateWeighted(store_.getCumulativeStrategySum(id), weights.strategy, strategy);
+    }
+    return regretsum_strategy_utility;
+}
+
+template <InfoSetKey Key>
+typename InfoSetStore<Key>::Statistics OutOfCoreCFR<Key>::getStatistics() const {
+    return store_.getStatistics();
+}
+
+template <InfoSetKey Key>
+InfoSetMap<Key> OutOfCoreCFR<Key>::getStrategyInfoSets() {
+    return store_.toInfoSetMap();
+}
+
+// Explicit instantiation definitions
+template class OutOfCoreCFR<string>;
+template class OutOfCoreCFR<size_t>;
@@ -0,0 +1,606 @@
+#include "cfr/ShardedCFR.h"
+#include "Utils.h"
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <fcntl.h>
+#include <pthread.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+
+template <InfoSetKey Key>
+struct ShardedCFR<Key>::SharedHeader {
+    pthread_barrier_t barrier;
+    // first phase in which a worker failed, see runWorker
+    atomic<int64_t> failed_phase;
+    double root_value;
+};
+
+namespace {
+    [[noreturn]]
+    void throwSystemError(const string& what) {
+        throw runtime_error(what + ": " + strerror(errno));
+    }
+
+    size_t alignUp(size_t size, size_t alignment) {
+        return (size + alignment - 1) / alignment * alignment;
+    }
+
+    constexpr int64_t NO_FAILED_PHASE = numeric_limits<int64_t>::max();
+}
+
+
+template <InfoSetKey Key>
+ShardedCFR<Key>::ShardedCFR(
+    shared_ptr<const GameNode> root_node,
+    int n_workers,
+    const InfoSetMap<Key>& initial_state
+) :
+    root_node_(root_node),
+    n_workers_(n_workers),
+    work_depth_(0),
+    n_work_items_(0),
+    region_(nullptr),
+    region_size_(0),
+    header_(nullptr)
+{
+    if (!root_node_) {
+        throw invalid_argument("Root node cannot be null");
+    }
+    if (n_workers_ <= 0) {
+        throw invalid_argument("Number of workers must be positive");
+    }
+
+    vector<Key> keys;
+    vector<size_t> n_actions;
+    unordered_map<Key, size_t> seen;
+    collectInfoSets(root_node_, keys, n_actions, seen);
+
+    // ids grouped by shard, in traversal order within a shard
+    vector<int> shards(keys.size());
+    for (size_t i = 0; i < keys.size(); i++) {
+        shards[i] = cpp_utils::mixHash(hash<Key>{}(keys[i])) % n_workers_;
+    }
+    vector<size_t> order(keys.size());
+    iota(order.begin(), order.end(), 0);
+    stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        return shards[a] < shards[b];
+    });
+
+    // the key index is only needed until the exchanges are laid out
+    unordered_map<Key, size_t> ids;
+    ids.reserve(keys.size());
+    shard_offsets_.assign(n_workers_ + 1, 0);
+    infoset_offsets_.push_back(0);
+    for (size_t i : order) {
+        ids.emplace(keys[i], infoset_keys_.size());
+        infoset_keys_.push_back(keys[i]);
+        infoset_offsets_.push_back(infoset_offsets_.back() + n_actions[i]);
+        shard_offsets_[shards[i] + 1]++;
+    }
+    partial_sum(shard_offsets_.begin(), shard_offsets_.end(), shard_offsets_.begin());
+
+    initExchanges(ids, initWorkDepth());
+    mapSharedRegion();
+
+    // initial sums as in CFRPlus: from the initial state or a new InfoSet
+    for (size_t id = 0; id < infoset_keys_.size(); id++) {
+        size_t n = infoset_offsets_[id + 1] - infoset_offsets_[id];
+        auto it = initial_state.find(infoset_keys_[id]);
+        InfoSet infoset = it != initial_state.end() ? it->second : InfoSet(n);
+        if (infoset.getRegretSum().size() != n) {
+            throw logic_error("Info set has a different number of actions than its node");
+        }
+        copy(infoset.getRegretSum().begin(), infoset.getRegretSum().end(),
+             regret_sums_ + infoset_offsets_[id]);
+        copy(infoset.getCumulativeStrategySum().begin(), infoset.getCumulativeStrategySum().end(),
+             strategy_sums_ + infoset_offsets_[id]);
+    }
+}
+
+template <InfoSetKey Key>
+ShardedCFR<Key>::~ShardedCFR() {
+    if (region_ != nullptr) {
+        munmap(region_, region_size_);
+    }
+}
+
+template <InfoSetKey Key>
+void ShardedCFR<Key>::collectInfoSets(
+    const shared_ptr<const GameNode>& node,
+    vector<Key>& keys,
+    vector<size_t>& n_actions,
+    unordered_map<Key, size_t>& seen
+) const {
+    if (node->getType() == GameNode::Type::Terminal) {
+        return;
+    }
+    const vector<int>& actions = node->getLegalActions();
+    if (node->getType() == GameNode::Type::Decision) {
+        Key key = node->getInfoSetKey<Key>();
+        auto [it, inserted] = seen.try_emplace(key, actions.size());
+        if (inserted) {
+            keys.push_back(key);
+            n_actions.push_back(actions.size());
+        } else if (it->second != actions.size()) {
+            throw logic_error("Nodes of an info set disagree on the number of actions");
+        }
+    }
+    for (int action : actions) {
+        collectInfoSets(node->applyAction(action), keys, n_actions, seen);
+    }
+}
+
+template <InfoSetKey Key>
+vector<shared_ptr<const GameNode>> ShardedCFR<Key>::initWorkDepth() {
+    // smallest depth with enough nodes to keep all workers busy
+    vector<shared_ptr<const GameNode>> level = {root_node_};
+    while (level.size() < MIN_WORK_ITEMS) {
+        vector<shared_ptr<const GameNode>> next_level;
+        for (const auto& node : level) {
+            if (node->getType() == GameNode::Type::Terminal) {
+                continue;
+            }
+            for (int action : node->getLegalActions()) {
+                next_level.push_back(node->applyAction(action));
+            }
+        }
+        if (next_level.empty()) {
+            break;
+        }
+        level = std::move(next_level);
+        work_depth_++;
+    }
+    n_work_items_ = level.size();
+    return level;
+}
+
+template <InfoSetKey Key>
+void ShardedCFR<Key>::initExchanges(
+    const unordered_map<Key, size_t>& ids,
+    const vector<shared_ptr<const GameNode>>& items
+) {
+    exchanges_.resize(n_workers_);
+    vector<bool> marks;
+    for (int worker = 0; worker < n_workers_; worker++) {
+        // every worker reads the prefix strategies to record the items
+        marks.assign(infoset_keys_.size(), false);
+        markInfoSets(root_node_, 0, work_depth_, ids, marks);
+        for (size_t item = worker; item < items.size(); item += n_workers_) {
+            markInfoSets(items[item], work_depth_, numeric_limits<int>::max(), ids, marks);
+        }
+
+        Exchange& exchange = exchanges_[worker];
+        exchange.owner_begin.assign(n_workers_ + 1, 0);
+        exchange.value_begin.assign(n_workers_ + 1, 0);
+        size_t n_values = 0;
+        for (int owner = 0; owner < n_workers_; owner++) {
+            exchange.owner_begin[owner] = exchange.ids.size();
+            exchange.value_begin[owner] = n_values;
+            for (size_t id = shard_offsets_[owner]; id < shard_offsets_[owner + 1]; id++) {
+                if (marks[id]) {
+                    exchange.ids.push_back(id);
+                    n_values += 2 * (infoset_offsets_[id + 1] - infoset_offsets_[id]);
+                }
+            }
+        }
+        exchange.owner_begin[n_workers_] = exchange.ids.size();
+        exchange.value_begin[n_workers_] = n_values;
+    }
+}
+
+template <InfoSetKey Key>
+void ShardedCFR<Key>::markInfoSets(
+    const shared_ptr<const GameNode>& node,
+    int depth,
+    int stop_depth,
+    const unordered_map<Key, size_t>& ids,
+    vector<bool>& marks
+) const {
+    if (depth == stop_depth || node->getType() == GameNode::Type::Terminal) {
+        return;
+    }
+    const vector<int>& actions = node->getLegalActions();
+    if (node->getType() == GameNode::Type::Decision) {
+        marks[ids.at(node->getInfoSetKey<Key>())] = true;
+    }
+    for (int action : actions) {
+        markInfoSets(node->applyAction(action), depth + 1, stop_depth, ids, marks);
+    }
+}
+
+template <InfoSetKey Key>
+void ShardedCFR<Key>::mapSharedRegion() {
+    size_t n_values = infoset_offsets_.back();
+    size_t n_exchange_values = 0;
+    for (const Exchange& exchange : exchanges_) {
+        n_exchange_values += exchange.value_begin.back();
+    }
+    size_t header_size = alignUp(sizeof(SharedHeader), 64);
+    region_size_ = header_size + sizeof(double) * (
+        3 * n_values + n_work_items_ + n_exchange_values
+    );
+
+    // the name only lives until the region is mapped, forked workers inherit the mapping
+    static atomic<uint64_t> region_counter = 0;
+    string name = "/game_algorithms_" + to_string(getpid()) + "_" + to_string(region_counter++);
+    int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (fd < 0) {
+        throwSystemError("shm_open failed");
+    }
+    shm_unlink(name.c_str());
+    if (ftruncate(fd, region_size_) != 0) {
+        close(fd);
+        throwSystemError("ftruncate of the shared region failed");
+    }
+    void* region = mmap(nullptr, region_size_, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (region == MAP_FAILED) {
+        throwSystemError("mmap of the shared region failed");
+    }
+    region_ = region;
+
+    // fresh shared memory is zero filled
+    header_ = new (region_) SharedHeader();
+    double* values = reinterpret_cast<double*>(static_cast<char*>(region_) + header_size);
+    regret_sums_ = values;
+    strategy_sums_ = regret_sums_ + n_values;
+    strategies_ = strategy_sums_ + n_values;
+    item_values_ = strategies_ + n_values;
+    double* exchange_values = item_values_ + n_work_items_;
+    for (Exchange& exchange : exchanges_) {
+        exchange.values = exchange_values;
+        exchange_values += exchange.value_begin.back();
+    }
+}
+
+template <InfoSetKey Key>
+double ShardedCFR<Key>::train(int n_iterations) {
+    if (n_iterations <= 0) {
+        return header_->root_value;
+    }
+
+    pthread_barrierattr_t barrier_attr;
+    pthread_barrierattr_init(&barrier_attr);
+    pthread_barrierattr_setpshared(&barrier_attr, PTHREAD_PROCESS_SHARED);
+    int barrier_status = pthread_barrier_init(&header_->barrier, &barrier_attr, n_workers_);
+    pthread_barrierattr_destroy(&barrier_attr);
+    if (barrier_status != 0) {
+        errno = barrier_status;
+        throwSystemError("pthread_barrier_init failed");
+    }
+    header_->failed_phase = NO_FAILED_PHASE;
+
+    vector<pid_t> pids;
+    vector<int> error_pipes;
+    string error;
+    for (int worker = 0; worker < n_workers_ && error.empty(); worker++) {
+        int fds[2];
+        if (pipe(fds) != 0) {
+            error = string("pipe failed: ") + strerror(errno);
+            break;
+        }
+        pid_t pid = fork();
+        if (pid < 0) {
+            error = string("fork failed: ") + strerror(errno);
+            close(fds[0]);
+            close(fds[1]);
+            break;
+        }
+        if (pid == 0) {
+            close(fds[0]);
+            string message = runWorker(worker, n_iterations);
+            if (!message.empty()) {
+                ssize_t written = write(fds[1], message.data(), message.size());
+                (void) written;
+            }
+            close(fds[1]);
+            _exit(message.empty() ? 0 : 1);
+        }
+        close(fds[1]);
+        pids.push_back(pid);
+        error_pipes.push_back(fds[0]);
+    }
+
+    // a worker that died without reaching the barrier would block the others forever
+    bool stop_all = (int) pids.size() < n_workers_;
+    vector<int> statuses(pids.size(), 0);
+    vector<bool> exited(pids.size(), false);
+    size_t n_exited = 0;
+    while (n_exited < pids.size()) {
+        if (stop_all) {
+            for (size_t worker = 0; worker < pids.size(); worker++) {
+                if (!exited[worker]) {
+                    kill(pids[worker], SIGKILL);
+                }
+            }
+        }
+        // polls only our own children, other children of the process are left alone
+        bool any_exited = false;
+        for (size_t worker = 0; worker < pids.size(); worker++) {
+            if (exited[worker] || waitpid(pids[worker], &statuses[worker], WNOHANG) == 0) {
+                continue;
+            }
+            exited[worker] = true;
+            any_exited = true;
+            n_exited++;
+            if (!WIFEXITED(statuses[worker])) {
+                stop_all = true;
+            }
+        }
+        if (!any_exited) {
+            usleep(1000);
+        }
+    }
+
+    // messages are short, workers never block on a full pipe
+    for (size_t worker = 0; worker < pids.size(); worker++) {
+        string message;
+        char chunk[256];
+        ssize_t n_read;
+        while ((n_read = read(error_pipes[worker], chunk, sizeof(chunk))) > 0) {
+            message.append(chunk, n_read);
+        }
+        close(error_pipes[worker]);
+
+        int status = statuses[worker];
+        if (error.empty() && !message.empty()) {
+            error = "worker " + to_string(worker) + ": " + message;
+        } else if (error.empty() && !(WIFEXITED(status) && WEXITSTATUS(status) == 0)) {
+            error = "worker " + to_string(worker) + " terminated abnormally";
+        }
+    }
+    pthread_barrier_destroy(&header_->barrier);
+
+    if (!error.empty()) {
+        throw runtime_error("ShardedCFR training failed, " + error);
+    }
+    return header_->root_value;
+}
+
+template <InfoSetKey Key>
+string ShardedCFR<Key>::runWorker(int worker, int n_iterations) {
+    string message;
+    WorkerIndex index;
+    // sums of the owned shard over all workers' blocks
+    vector<double> regrets;
+    vector<double> strategies;
+
+    // Runs one phase and waits for all workers, false once any worker failed.
+    // A failure is recorded with its phase before that phase's barrier, so
+    // every worker sees it right after the barrier. A fast worker failing
+    // in the next phase cannot stop a slow one early: that failure's phase
+    // is later than the one the slow worker is checking.
+    int64_t phase_index = 0;
+    auto phase = [&](const function<void()>& work) {
+        if (message.empty()) {
+            try {
+                work();
+            } catch (const exception& e) {
+                message = e.what();
+                int64_t no_failure = NO_FAILED_PHASE;
+                header_->failed_phase.compare_exchange_strong(no_failure, phase_index);
+            }
+        }
+        pthread_barrier_wait(&header_->barrier);
+        return header_->failed_phase > phase_index++;
+    };
+
+    bool ok = phase([&]() {
+        index = buildWorkerIndex(worker);
+        size_t n_shard_values =
+            infoset_offsets_[shard_offsets_[worker + 1]] - infoset_offsets_[shard_offsets_[worker]];
+        regrets.assign(n_shard_values, 0);
+        strategies.assign(n_shard_values, 0);
+    });
+    for (int iteration = 0; ok && iteration < n_iterations; iteration++) {
+        ok = phase([&]() {
+            computeShardStrategies(worker);
+        });
+        ok = ok && phase([&]() {
+            work_items_.clear();
+            size_t next_item = 0;
+            processNode(root_node_, 0, 1, 1, 1, index, PrefixPass::CollectItems, next_item);
+            for (size_t item = worker; item < work_items_.size(); item += n_workers_) {
+                const WorkItem& work_item = work_items_[item];
+                item_values_[item] = processNode(
+                    work_item.node, work_depth_,
+                    work_item.p_past_actions_p0,
+                    work_item.p_past_actions_p1,
+                    work_item.p_past_chances,
+                    index, PrefixPass::None, next_item
+                );
+            }
+        });
+        ok = ok && phase([&]() {
+            if (worker == 0) {
+                size_t next_item = 0;
+                header_->root_value = processNode(
+                    root_node_, 0, 1, 1, 1, index, PrefixPass::UseItems, next_item
+                );
+            }
+        });
+        ok = ok && phase([&]() {
+            reduceShard(worker, regrets, strategies);
+        });
+    }
+    return message;
+}
+
+template <InfoSetKey Key>
+typename ShardedCFR<Key>::WorkerIndex ShardedCFR<Key>::buildWorkerIndex(int worker) const {
+    const Exchange& exchange = exchanges_[worker];
+    WorkerIndex index;
+    index.reserve(exchange.ids.size());
+    double* values = exchange.values;
+    for (size_t id : exchange.ids) {
+        index.emplace(infoset_keys_[id], Slot{infoset_offsets_[id], values});
+        values += 2 * (infoset_offsets_[id + 1] - infoset_offsets_[id]);
+    }
+    return index;
+}
+
+template <InfoSetKey Key>
+void ShardedCFR<Key>::computeShardStrategies(int worker) {
+    for (size_t id = shard_offsets_[worker]; id < shard_offsets_[worker + 1]; id++) {
+        size_t begin = infoset_offsets_[id];
+        size_t n_actions = infoset_offsets_[id + 1] - begin;
+        strategy_utils::normalizeStrategyInto(
+            span<const double>(regret_sums_ + begin, n_actions),
+            span<double>(strategies_ + begin, n_actions)
+        );
+    }
+}
+
+template <InfoSetKey Key>
+void ShardedCFR<Key>::reduceShard(int worker, vector<double>& regrets, vector<double>& strategies) {
+    size_t shard_begin = infoset_offsets_[shard_offsets_[worker]];
+    // fixed worker order keeps the sums deterministic
+    for (const Exchange& exchange : exchanges_) {
+        double* values = exchange.values + exchange.value_begin[worker];
+        for (size_t entry = exchange.owner_begin[worker]; entry < exchange.owner_begin[worker + 1]; entry++) {
+            size_t id = exchange.ids[entry];
+            size_t n_actions = infoset_offsets_[id + 1] - infoset_offsets_[id];
+            size_t local = infoset_offsets_[id] - shard_begin;
+            for (size_t action_idx = 0; action_idx < n_actions; action_idx++) {
+                regrets[local + action_idx] += values[action_idx];
+                strategies[local + action_idx] += values[n_actions + action_idx];
+            }
+            fill(values, values + 2 * n_actions, 0.0);
+            values += 2 * n_actions;
+        }
+    }
+    // the blocks are already weighted
+    cfr_utils::accumulatePositiveRegret(span(regret_sums_ + shard_begin, regrets.size()), 1.0, regrets);
+    cfr_utils::accumulateWeighted(span(strategy_sums_ + shard_begin, strategies.size()), 1.0, strategies);
+    fill(regrets.begin(), regrets.end(), 0.0);
+    fill(strategies.begin(), strategies.end(), 0.0);
+}
+
+template <InfoSetKey Key>
+double ShardedCFR<Key>::processNode(
+    const shared_ptr<const GameNode>& node,
+    int depth,
+    double p_past_actions_p0,
+    double p_past_actions_p1,
+    double p_past_chances,
+    const WorkerIndex& index,
+    PrefixPass pass,
+    size_t& next_item
+) {
+    if (pass != PrefixPass::None && depth == work_depth_) {
+        if (pass == PrefixPass::CollectItems) {
+            work_items_.push_back({node, p_past_actions_p0, p_past_actions_p1, p_past_chances});
+            return 0;
+        }
+        return item_values_[next_item++];
+    }
+
+    switch (node->getType()) {
+    case GameNode::Type::Terminal:
+        return node->getTerminalUtilities()[0];
+
+    case GameNode::Type::Chance: {
+        const vector<int>& actions = node->getLegalActions();
+        const vector<double>& chance_probs = node->getChanceProbabilities();
+        double value = 0;
+        for (size_t action_idx = 0; action_idx < actions.size(); action_idx++) {
+            value += chance_probs[action_idx] * processNode(
+                node->applyAction(actions[action_idx]), depth + 1,
+                p_past_actions_p0, p_past_actions_p1,
+                p_past_chances * chance_probs[action_idx],
+                index, pass, next_item
+            );
+        }
+        return value;
+    }
+
+    case GameNode::Type::Decision:
+        break;
+
+    default:
+        throw logic_error("Unexpected type");
+    }
+
+    const vector<int>& actions = node->getLegalActions();
+    size_t n_actions = actions.size();
+    int player = node->getCurrentPlayer();
+    const Slot& slot = index.at(node->getInfoSetKey<Key>());
+    const double* strategy = strategies_ + slot.offset;
+
+    vector<double> action_values(n_actions);
+    double value = 0;
+    for (size_t action_idx = 0; action_idx < n_actions; action_idx++) {
+        action_values[action_idx] = processNode(
+            node->applyAction(actions[action_idx]), depth + 1,
+            player == 0 ? p_past_actions_p0 * strategy[action_idx] : p_past_actions_p0,
+            player == 1 ? p_past_actions_p1 * strategy[action_idx] : p_past_actions_p1,
+            p_past_chances,
+            index, pass, next_item
+        );
+        value += strategy[action_idx] * action_values[action_idx];
+    }
+    if (pass == PrefixPass::CollectItems) {
+        return 0;
+    }
+
+    cfr_utils::UpdateWeights weights = cfr_utils::getUpdateWeights(
+        player, p_past_actions_p0, p_past_actions_p1, p_past_chances
+    );
+    vector<double> instant_regrets(n_actions);
+    cfr_utils::computeInstantRegrets(player, action_values, value, instant_regrets);
+    cfr_utils::accumulateWeighted(span(slot.contributions, n_actions), weights.regret, instant_regrets);
+    cfr_utils::accumulateWeighted(
+        span(slot.contributions + n_actions, n_actions), weights.strategy, span(strategy, n_actions)
+    );
+    return value;
+}
+
+template <InfoSetKey Key>
+InfoSetMap<Key> ShardedCFR<Key>::getStrategyInfoSets() const {
+    InfoSetMap<Key> infosets;
+    infosets.reserve(infoset_keys_.size());
+    for (size_t id = 0; id < infoset_keys_.size(); id++) {
+        size_t begin = infoset_offsets_[id];
+        size_t end = infoset_offsets_[id + 1];
+        infosets.try_emplace(
+            infoset_keys_[id],
+            vector<double>(regret_sums_ + begin, regret_sums_ + end),
+            vector<double>(strategy_sums_ + begin, strategy_sums_ + end)
+        );
+    }
+    return infosets;
+}
+
+template <InfoSetKey Key>
+int ShardedCFR<Key>::getWorkerCount() const {
+    return n_workers_;
+}
+
+template <InfoSetKey Key>
+size_t ShardedCFR<Key>::getInfoSetCount() const {
+    return infoset_keys_.size();
+}
+
+template <InfoSetKey Key>
+size_t ShardedCFR<Key>::getShardSize(int worker) const {
+    return shard_offsets_.at(worker + 1) - shard_offsets_.at(worker);
+}
+
+template <InfoSetKey Key>
+size_t ShardedCFR<Key>::getWorkItemCount() const {
+    return n_work_items_;
+}
+
+// Explicit instantiation definitions
+template class ShardedCFR<string>;
+template class ShardedCFR<size_t>;
@@ -0,0 +1,281 @@
+#include "cfr/VectorCFR.h"
+#include "abstract/infoset/InfoSetUtils.h"
+#include "Utils.h"
+#include <algorithm>
+#include <bit>
+#include <stdexcept>
+
+
+template <InfoSetKey Key>
+VectorCFR<Key>::VectorCFR(
+    shared_ptr<const PublicTreeNode> root,
+    const InfoSetMap<Key>& initial_state
+) :
+    infosets_(initial_state)
+{
+    if (!root) {
+        throw invalid_argument("Root node cannot be null");
+    }
+    n_states_[0] = root->getPrivateStateCount(0);
+    n_states_[1] = root->getPrivateStateCount(1);
+    if (root->getPrivateStatePrior().size() != n_states_[0] * n_states_[1]) {
+        throw invalid_argument("Private state prior does not match the private state counts");
+    }
+
+    addNode(root);
+    node_first_edge_.push_back(edge_child_.size());
+    matrix_ids_.clear();
+}
+
+template <InfoSetKey Key>
+size_t VectorCFR<Key>::addNode(const shared_ptr<const PublicTreeNode>& node) {
+    size_t id = node_type_.size();
+    node_type_.push_back(node->getType());
+    node_player_.push_back(-1);
+    node_slot_.push_back(0);
+    node_first_edge_.push_back(edge_child_.size());
+
+    if (node->getType() == GameNode::Type::Terminal) {
+        node_slot_[id] = addTerminalMatrices(node);
+        return id;
+    }
+    if (node->getType() != GameNode::Type::Decision) {
+        throw logic_error("VectorCFR supports only decision and terminal public nodes");
+    }
+
+    int player = node->getCurrentPlayer();
+    if (player != 0 && player != 1) {
+        throw logic_error("VectorCFR supports only two-player games");
+    }
+    const vector<int>& actions = node->getLegalActions();
+    node_player_[id] = player;
+    node_slot_[id] = node_infosets_.size();
+    for (size_t state = 0; state < n_states_[player]; state++) {
+        node_infosets_.push_back(&infoset_utils::findOrAddInfoSet(
+            infosets_, node->getInfoSetKey<Key>(state), actions.size()
+        ));
+    }
+
+    // children are added after the edge block of this node is reserved
+    size_t first_edge = edge_child_.size();
+    edge_child_.resize(first_edge + actions.size());
+    for (size_t action_idx = 0; action_idx < actions.size(); action_idx++) {
+        size_t child = addNode(node->applyAction(actions[action_idx]));
+        edge_child_[first_edge + action_idx] = child;
+    }
+    return id;
+}
+
+template <InfoSetKey Key>
+size_t VectorCFR<Key>::addTerminalMatrices(const shared_ptr<const PublicTreeNode>& node) {
+    const vector<double>& prior = node->getPrivateStatePrior();
+    size_t n_pairs = prior.size();
+
+    vector<double> matrices(2 * n_pairs);
+    for (int player = 0; player < 2; player++) {
+        vector<double> utilities = node->getTerminalUtilityMatrix(player);
+        if (utilities.size() != n_pairs) {
+            throw logic_error("Terminal utility matrix does not match the private state counts");
+        }
+        for (size_t pair = 0; pair < n_pairs; pair++) {
+            matrices[player * n_pairs + pair] = prior[pair] * utilities[pair];
+        }
+    }
+
+    uint64_t hash = 0;
+    for (double value : matrices) {
+        hash = cpp_utils::hashCombine(hash, bit_cast<uint64_t>(value));
+    }
+    auto [begin, end] = matrix_ids_.equal_range(hash);
+    for (auto it = begin; it != end; it++) {
+        auto stored = terminal_matrices_.begin() + 2 * n_pairs * it->second;
+        if (equal(matrices.begin(), matrices.end(), stored)) {
+            return it->second;
+        }
+    }
+
+    size_t matrix_id = terminal_matrices_.size() / (2 * n_pairs);
+    terminal_matrices_.insert(terminal_matrices_.end(), matrices.begin(), matrices.end());
+    matrix_ids_.emplace(hash, matrix_id);
+    return matrix_id;
+}
+
+template <InfoSetKey Key>
+double VectorCFR<Key>::evaluateAndUpdateRegretSum(
+    bool accumulate_regsum,
+    bool accumulate_strategy
+) {
+    vector<double> reach_0(n_states_[0], 1.0);
+    vector<double> reach_1(n_states_[1], 1.0);
+    vector<double> cfv_0(n_states_[0]);
+    vector<double> cfv_1(n_states_[1]);
+    const double* const reach[2] = {reach_0.data(), reach_1.data()};
+    double* const cfv[2] = {cfv_0.data(), cfv_1.data()};
+
+    processNode(0, reach, cfv, accumulate_regsum, accumulate_strategy);
+
+    double value = 0;
+    for (double state_value : cfv_0) {
+        value += state_value;
+    }
+    return value;
+}
+
+template <InfoSetKey Key>
+double VectorCFR<Key>::evaluateRegretSum() {
+    return evaluateAndUpdateRegretSum(false, false);
+}
+
+template <InfoSetKey Key>
+void VectorCFR<Key>::processNode(
+    size_t node,
+    const double* const reach[2],
+    double* const cfv[2],
+    bool accumulate_regsum,
+    bool accumulate_strategy
+) {
+    if (node_type_[node] == GameNode::Type::Terminal) {
+        processTerminalNode(node, reach, cfv);
+    } else {
+        processDecisionNode(node, reach, cfv, accumulate_regsum, accumulate_strategy);
+    }
+}
+
+template <InfoSetKey Key>
+void VectorCFR<Key>::processDecisionNode(
+    size_t node,
+    const double* const reach[2],
+    double* const cfv[2],
+    bool accumulate_regsum,
+    bool accumulate_strategy
+) {
+    int player = node_player_[node];
+    int opponent = 1 - player;
+    size_t n_own = n_states_[player];
+    size_t n_opponent = n_states_[opponent];
+    size_t first_edge = node_first_edge_[node];
+    size_t n_actions = node_first_edge_[node + 1] - first_edge;
+    InfoSet* const* infosets = node_infosets_.data() + node_slot_[node];
+
+    // strategy[state * n_actions + action]
+    vector<double> strategy(n_own * n_actions);
+    for (size_t state = 0; state < n_own; state++) {
+        const vector<double>& infoset_strategy = infosets[state]->getRegretSumStrategy();
+        copy(infoset_strategy.begin(), infoset_strategy.end(), strategy.begin() + state * n_actions);
+    }
+
+    // action_values[action * n_own + state]
+    vector<double> action_values(n_actions * n_own);
+    vector<double> child_reach(n_own);
+    vector<double> child_opponent_values(n_opponent);
+    fill(cfv[opponent], cfv[opponent] + n_opponent, 0.0);
+
+    for (size_t action_idx = 0; action_idx < n_actions; action_idx++) {
+        for (size_t state = 0; state < n_own; state++) {
+            child_reach[state] = reach[player][state] * strategy[state * n_actions + action_idx];
+        }
+
+        const double* child_reaches[2];
+        double* child_values[2];
+        child_reaches[player] = child_reach.data();
+        child_reaches[opponent] = reach[opponent];
+        child_values[player] = action_values.data() + action_idx * n_own;
+        child_values[opponent] = child_opponent_values.data();
+        processNode(
+            edge_child_[first_edge + action_idx],
+            child_reaches, child_values,
+            accumulate_regsum, accumulate_strategy
+        );
+
+        // opponent's reach is unchanged, its values add up over actions
+        for (size_t state = 0; state < n_opponent; state++) {
+            cfv[opponent][state] += child_opponent_values[state];
+        }
+    }
+
+    for (size_t state = 0; state < n_own; state++) {
+        double value = 0;
+        for (size_t action_idx = 0; action_idx < n_actions; action_idx++) {
+            value += strategy[state * n_actions + action_idx] * action_values[action_idx * n_own + state];
+        }
+        cfv[player][state] = value;
+    }
+
+    // counterfactual values already carry the chance and opponent reach,
+    // so the regrets are accumulated with weight 1
+    for (size_t state = 0; state < n_own; state++) {
+        InfoSet& infoset = *infosets[state];
+        for (size_t action_idx = 0; action_idx < n_actions; action_idx++) {
+            infoset.setInstantRegret(
+                action_idx, action_values[action_idx * n_own + state] - cfv[player][state]
+            );
+        }
+        if (accumulate_regsum) {
+            infoset.accumulateRegret(1.0);
+        }
+        if (accumulate_strategy) {
+            // strategy of this iteration, regrets above may have changed the cached one
+            vector<double> played_strategy(
+                strategy.begin() + state * n_actions,
+                strategy.begin() + (state + 1) * n_actions
+            );
+            infoset.accumulateStrategy(reach[player][state], played_strategy);
+        }
+    }
+}
+
+template <InfoSetKey Key>
+void VectorCFR<Key>::processTerminalNode(
+    size_t node,
+    const double* const reach[2],
+    double* const cfv[2]
+) const {
+    size_t n_0 = n_states_[0];
+    size_t n_1 = n_states_[1];
+    const double* matrix_0 = terminal_matrices_.data() + 2 * n_0 * n_1 * node_slot_[node];
+    const double* matrix_1 = matrix_0 + n_0 * n_1;
+
+    // cfv_0 = M_0 * reach_1, a dot product per row
+    for (size_t state_0 = 0; state_0 < n_0; state_0++) {
+        const double* row = matrix_0 + state_0 * n_1;
+        double value = 0;
+        for (size_t state_1 = 0; state_1 < n_1; state_1++) {
+            value += row[state_1] * reach[1][state_1];
+        }
+        cfv[0][state_0] = value;
+    }
+
+    // cfv_1 = M_1^T * reach_0, accumulated row by row to stay contiguous
+    double* values_1 = cfv[1];
+    fill(values_1, values_1 + n_1, 0.0);
+    for (size_t state_0 = 0; state_0 < n_0; state_0++) {
+        double reach_0 = reach[0][state_0];
+        if (reach_0 == 0) {
+            continue;
+        }
+        const double* row = matrix_1 + state_0 * n_1;
+        for (size_t state_1 = 0; state_1 < n_1; state_1++) {
+            values_1[state_1] += reach_0 * row[state_1];
+        }
+    }
+}
+
+template <InfoSetKey Key>
+const InfoSetMap<Key>& VectorCFR<Key>::getStrategyInfoSets() const {
+    return infosets_;
+}
+
+template <InfoSetKey Key>
+size_t VectorCFR<Key>::getPublicNodeCount() const {
+    return node_type_.size();
+}
+
+template <InfoSetKey Key>
+size_t VectorCFR<Key>::getTerminalMatrixCount() const {
+    size_t n_pairs = n_states_[0] * n_states_[1];
+    return n_pairs == 0 ? 0 : terminal_matrices_.size() / (2 * n_pairs);
+}
+
+// Explicit instantiation definitions
+template class VectorCFR<string>;
+template class VectorCFR<size_t>;
@@ -8,15 +8,16 @@ CFRE<ISKey>::CFRE(
     int n_players,
     bool inital_evaluation_run,
     double e_soft_regsum_strategies,
-    const InfoSetMap<ISKey>& initial_infosets
+    const InfoSetMap<ISKey>& initial_infosets,
+    size_t infoset_capacity_hint
 ):
     root_node_(root_node),
     infosets_(initial_infosets),
     e_soft_regsum_strategies_(e_soft_regsum_strategies),
     n_players_(n_players)
 {
-    if (infosets_.empty()) {
-        initInfoStates();
+    if (infoset_capacity_hint > 0) {
+        infosets_.reserve(infoset_capacity_hint);
     }
 
     if (inital_evaluation_run) {
@@ -24,29 +25,6 @@ CFRE<ISKey>::CFRE(
     }
 }
 
-template<InfoSetKey ISKey>
-void CFRE<ISKey>::initInfoStates() {
-    initInfoStatesRecursively(root_node_);
-}
-
-template<InfoSetKey ISKey>
-void CFRE<ISKey>::initInfoStatesRecursively(const shared_ptr<const GameNode> node) {
-    if (node->getType() == GameNode::Type::Terminal) {
-        return;
-    }
-
-    const vector<int>& actions = node->getLegalActions();
-
-    if (node->getType() == GameNode::Type::Decision) {
-        ISKey infoset_key = getInfoSetKey(node);
-        infosets_.try_emplace(infoset_key, actions.size());
-    }
-
-    for (int action : actions) {
-        initInfoStatesRecursively(node->applyAction(action));
-    }
-}
-
 template<InfoSetKey ISKey>
 const InfoSetMap<ISKey>& CFRE<ISKey>::getStrategyInfoSets() {
     return infosets_;
@@ -130,7 +108,8 @@ vector<double> CFRE<ISKey>::processDecisionNode(
     
     const ISKey& infoset_key = getInfoSetKey(node);
 
-    InfoSet& infoset = infosets_.at(infoset_key);
+    // created on the first visit, references survive rehashing
+    InfoSet& infoset = infoset_utils::findOrAddInfoSet(infosets_, infoset_key, n_available_actions);
     
     // e_soft strategy to add weight to "impossible" events - experimental
     vector<double> regretsum_strategy = infoset.getRegretSumStrategy();
@@ -0,0 +1,255 @@
+#include "goofspiel/GoofspielNode.h"
+#include <bit>
+#include <sstream>
+#include <stdexcept>
+
+namespace {
+    constexpr uint64_t N_OUTCOMES = 3;
+    constexpr int ROUND_BITS = 4;
+}
+
+
+GoofspielNode::GoofspielNode()
+    : GoofspielNode(Params())
+{ }
+
+GoofspielNode::GoofspielNode(const Params& params)
+    : GoofspielNode(make_shared<const Params>(params))
+{ }
+
+GoofspielNode::GoofspielNode(shared_ptr<const Params> params)
+    : params_(params),
+    phase_(Phase::PrizeReveal),
+    round_(0),
+    points_({0, 0}),
+    prizes_(),
+    bids_(),
+    encoded_view_({0, 0})
+{
+    int n_cards = params_->n_cards;
+    if (n_cards < 1 || n_cards > MAX_CARDS) {
+        throw invalid_argument(
+            "GoofspielNode supports 1 to " + to_string(MAX_CARDS) + " cards"
+        );
+    }
+    uint32_t full_hand = (1u << n_cards) - 1;
+    remaining_prizes_ = full_hand;
+    remaining_bids_ = {full_hand, full_hand};
+
+    if (params_->prize_order != PrizeOrder::Random) {
+        revealPrize(prizeForFixedOrder());
+    }
+    calculateProperties();
+}
+
+
+int GoofspielNode::rank(uint32_t remaining, int card) {
+    // number of remaining cards smaller than the given one
+    return popcount(remaining & ((1u << (card - 1)) - 1));
+}
+
+int GoofspielNode::prizeForFixedOrder() const {
+    return params_->prize_order == PrizeOrder::Ascending ?
+        round_ + 1 : params_->n_cards - round_;
+}
+
+void GoofspielNode::revealPrize(int prize) {
+    uint64_t radix = params_->n_cards - round_;
+    uint64_t digit = rank(remaining_prizes_, prize);
+    for (uint64_t& view : encoded_view_) {
+        view = view * radix + digit;
+    }
+
+    prizes_[round_] = prize;
+    remaining_prizes_ &= ~(1u << (prize - 1));
+    phase_ = Phase::Bid0;
+}
+
+void GoofspielNode::placeBid(int player, int card) {
+    uint64_t radix = params_->n_cards - round_;
+    encoded_view_[player] = \
+        encoded_view_[player] * radix + rank(remaining_bids_[player], card);
+
+    bids_[player][round_] = card;
+    remaining_bids_[player] &= ~(1u << (card - 1));
+    phase_ = (player == 0) ? Phase::Bid1 : Phase::PrizeReveal;
+}
+
+void GoofspielNode::resolveRound() {
+    int bid_0 = bids_[0][round_];
+    int bid_1 = bids_[1][round_];
+
+    // outcome digit: 0 - player 0 takes the prize, 1 - player 1, 2 - tie
+    uint64_t outcome = 2;
+    if (bid_0 > bid_1) {
+        points_[0] += prizes_[round_];
+        outcome = 0;
+    } else if (bid_1 > bid_0) {
+        points_[1] += prizes_[round_];
+        outcome = 1;
+    }
+    for (uint64_t& view : encoded_view_) {
+        view = view * N_OUTCOMES + outcome;
+    }
+
+    round_++;
+    if (round_ == params_->n_cards) {
+        phase_ = Phase::Finished;
+    } else if (params_->prize_order != PrizeOrder::Random) {
+        revealPrize(prizeForFixedOrder());
+    }
+}
+
+void GoofspielNode::calculateProperties() {
+    legal_actions_.clear();
+    chance_probabilities_.clear();
+
+    switch (phase_) {
+    case Phase::Finished: {
+        double diff = points_[0] - points_[1];
+        if (params_->win_loss_utility) {
+            diff = (diff > 0) - (diff < 0);
+        }
+        utilities_ = {diff, -diff};
+        break;
+    }
+    case Phase::PrizeReveal: {
+        for (int card = 1; card <= params_->n_cards; card++) {
+            if (remaining_prizes_ & (1u << (card - 1))) {
+                legal_actions_.push_back(card);
+            }
+        }
+        chance_probabilities_.assign(
+            legal_actions_.size(), 1.0 / legal_actions_.size()
+        );
+        break;
+    }
+    case Phase::Bid0:
+    case Phase::Bid1: {
+        uint32_t hand = remaining_bids_[getCurrentPlayer()];
+        for (int card = 1; card <= params_->n_cards; card++) {
+            if (hand & (1u << (card - 1))) {
+                legal_actions_.push_back(card);
+            }
+        }
+        break;
+    }
+    }
+}
+
+
+GameNode::Type GoofspielNode::getType() const {
+    switch (phase_) {
+    case Phase::Finished: return Type::Terminal;
+    case Phase::PrizeReveal: return Type::Chance;
+    default: return Type::Decision;
+    }
+}
+
+const vector<double>& GoofspielNode::getTerminalUtilities() const {
+    if (phase_ != Phase::Finished) {
+        throwWrongNodeTypeFnException("getTerminalUtilities");
+    }
+    return utilities_;
+}
+
+const vector<double>& GoofspielNode::getChanceProbabilities() const {
+    if (phase_ != Phase::PrizeReveal) {
+        throwWrongNodeTypeFnException("getChanceProbabilities");
+    }
+    return chance_probabilities_;
+}
+
+const vector<int>& GoofspielNode::getLegalActions() const {
+    if (phase_ == Phase::Finished) {
+        throwWrongNodeTypeFnException("getLegalActions");
+    }
+    return legal_actions_;
+}
+
+shared_ptr<const GameNode> GoofspielNode::applyAction(int action) const {
+    if (phase_ == Phase::Finished) {
+        throwWrongNodeTypeFnException("applyAction");
+    }
+    uint32_t available = (phase_ == Phase::PrizeReveal) ?
+        remaining_prizes_ : remaining_bids_[getCurrentPlayer()];
+    if (action < 1 || action > params_->n_cards || !(available & (1u << (action - 1)))) {
+        throw logic_error("Illegal action " + to_string(action));
+    }
+
+    auto next_node = make_shared<GoofspielNode>(*this);
+    if (phase_ == Phase::PrizeReveal) {
+        next_node->revealPrize(action);
+    } else {
+        int player = getCurrentPlayer();
+        next_node->placeBid(player, action);
+        if (player == 1) {
+            next_node->resolveRound();
+        }
+    }
+    next_node->calculateProperties();
+    return next_node;
+}
+
+int GoofspielNode::getCurrentPlayer() const {
+    switch (phase_) {
+    case Phase::Bid0: return 0;
+    case Phase::Bid1: return 1;
+    default: throwWrongNodeTypeFnException("getCurrentPlayer");
+    }
+}
+
+size_t GoofspielNode::getInfoSetKeyInt() const {
+    int player = getCurrentPlayer();
+    // round and player make the mixed-radix prefix length unambiguous
+    return (((encoded_view_[player] << 1) | player) << ROUND_BITS) | round_;
+}
+
+string GoofspielNode::getInfoSetKeyString() const {
+    int player = getCurrentPlayer();
+    ostringstream oss;
+    oss << "p" << player << " prizes:";
+    for (int r = 0; r <= round_; r++) {
+        oss << " " << prizes_[r];
+    }
+    oss << " bids:";
+    for (int r = 0; r < round_; r++) {
+        oss << " " << bids_[player][r];
+    }
+    oss << " outcomes:";
+    for (int r = 0; r < round_; r++) {
+        int bid_0 = bids_[0][r];
+        int bid_1 = bids_[1][r];
+        oss << " " << (bid_0 > bid_1 ? "0" : (bid_1 > bid_0 ? "1" : "="));
+    }
+    return oss.str();
+}
+
+string GoofspielNode::toString() const {
+    ostringstream oss;
+    oss << getTypeString() << " round " << round_
+        << " points " << points_[0] << ":" << points_[1];
+    if (phase_ == Phase::Bid0 || phase_ == Phase::Bid1) {
+        oss << " prize " << prizes_[round_];
+    }
+    return oss.str();
+}
+
+string GoofspielNode::actionToString(int action) const {
+    if (phase_ == Phase::PrizeReveal) {
+        return "prize " + to_string(action);
+    }
+    return "bid " + to_string(action);
+}
+
+const GoofspielNode::Params& GoofspielNode::getParams() const {
+    return *params_;
+}
+
+int GoofspielNode::getRound() const {
+    return round_;
+}
+
+const array<int, 2>& GoofspielNode::getPoints() const {
+    return points_;
+}
@@ -0,0 +1,273 @@
+#include "liars_dice/LiarsDiceNode.h"
+#include <bit>
+#include <cmath>
+#include <functional>
+#include <sstream>
+#include <stdexcept>
+
+
+LiarsDiceNode::LiarsDiceNode()
+    : LiarsDiceNode(Params())
+{ }
+
+LiarsDiceNode::LiarsDiceNode(const Params& params)
+    : tables_(buildTables(params)),
+    phase_(Phase::Deal),
+    rolls_{-1, -1},
+    bid_mask_(0),
+    last_bid_(-1)
+{
+    calculateProperties();
+}
+
+
+shared_ptr<const LiarsDiceNode::Tables> LiarsDiceNode::buildTables(const Params& params) {
+    if (params.dice_per_player < 1 || params.n_faces < 2) {
+        throw invalid_argument("LiarsDiceNode requires at least 1 die and 2 faces");
+    }
+
+    auto tables = make_shared<Tables>();
+    tables->params = params;
+    tables->n_bids = 2 * params.dice_per_player * params.n_faces;
+
+    // enumerate sorted rolls as face counts, with their multinomial probabilities
+    vector<double> roll_probabilities;
+    vector<int> face_counts(params.n_faces, 0);
+    double log_roll_count = params.dice_per_player * log(params.n_faces);
+
+    function<void(int, int)> enumerate = [&](int face, int dice_left) {
+        if (face == params.n_faces - 1) {
+            face_counts[face] = dice_left;
+            double log_p = lgamma(params.dice_per_player + 1) - log_roll_count;
+            for (int count : face_counts) {
+                log_p -= lgamma(count + 1);
+            }
+            tables->roll_face_counts.push_back(face_counts);
+            roll_probabilities.push_back(exp(log_p));
+            return;
+        }
+        for (int count = dice_left; count >= 0; count--) {
+            face_counts[face] = count;
+            enumerate(face + 1, dice_left - count);
+        }
+    };
+    enumerate(0, params.dice_per_player);
+
+    size_t n_rolls = tables->roll_face_counts.size();
+    tables->roll_bits = bit_width(n_rolls - 1);
+    if (tables->n_bids + tables->roll_bits > 64) {
+        throw invalid_argument(
+            "LiarsDiceNode bid history and roll do not fit a 64-bit info-set key"
+        );
+    }
+
+    // both hands are dealt in a single chance node
+    for (size_t roll_0 = 0; roll_0 < n_rolls; roll_0++) {
+        for (size_t roll_1 = 0; roll_1 < n_rolls; roll_1++) {
+            tables->root_actions.push_back(roll_0 * n_rolls + roll_1);
+            tables->root_probabilities.push_back(
+                roll_probabilities[roll_0] * roll_probabilities[roll_1]
+            );
+        }
+    }
+    return tables;
+}
+
+
+void LiarsDiceNode::calculateProperties() {
+    legal_actions_.clear();
+
+    if (phase_ == Phase::Bidding) {
+        for (int bid = last_bid_ + 1; bid < tables_->n_bids; bid++) {
+            legal_actions_.push_back(bid);
+        }
+        if (last_bid_ >= 0) {
+            legal_actions_.push_back(getLiarAction());
+        }
+    }
+}
+
+
+GameNode::Type LiarsDiceNode::getType() const {
+    switch (phase_) {
+    case Phase::Deal: return Type::Chance;
+    case Phase::Bidding: return Type::Decision;
+    default: return Type::Terminal;
+    }
+}
+
+const vector<double>& LiarsDiceNode::getTerminalUtilities() const {
+    if (phase_ != Phase::Finished) {
+        throwWrongNodeTypeFnException("getTerminalUtilities");
+    }
+    return utilities_;
+}
+
+const vector<double>& LiarsDiceNode::getChanceProbabilities() const {
+    if (phase_ != Phase::Deal) {
+        throwWrongNodeTypeFnException("getChanceProbabilities");
+    }
+    return tables_->root_probabilities;
+}
+
+const vector<int>& LiarsDiceNode::getLegalActions() const {
+    switch (phase_) {
+    case Phase::Deal: return tables_->root_actions;
+    case Phase::Bidding: return legal_actions_;
+    default: throwWrongNodeTypeFnException("getLegalActions");
+    }
+}
+
+shared_ptr<const GameNode> LiarsDiceNode::applyAction(int action) const {
+    auto next_node = make_shared<LiarsDiceNode>(*this);
+
+    switch (phase_) {
+    case Phase::Deal: {
+        int n_rolls = tables_->roll_face_counts.size();
+        if (action < 0 || action >= n_rolls * n_rolls) {
+            throw logic_error("Illegal action " + to_string(action));
+        }
+        next_node->rolls_[0] = action / n_rolls;
+        next_node->rolls_[1] = action % n_rolls;
+        next_node->phase_ = Phase::Bidding;
+        break;
+    }
+    case Phase::Bidding: {
+        if (action == getLiarAction() && last_bid_ >= 0) {
+            const Params& params = tables_->params;
+            int quantity = last_bid_ / params.n_faces + 1;
+            int face = last_bid_ % params.n_faces;
+            int wild_face = params.n_faces - 1;
+
+            int count = 0;
+            for (int roll_idx : rolls_) {
+                const vector<int>& face_counts = tables_->roll_face_counts[roll_idx];
+                count += face_counts[face];
+                if (params.highest_face_wild && face != wild_face) {
+                    count += face_counts[wild_face];
+                }
+            }
+
+            // the bidder is the previous player, the caller loses if the bid holds
+            int caller = getCurrentPlayer();
+            double caller_utility = (count >= quantity) ? -1.0 : 1.0;
+            next_node->utilities_ = caller == 0 ?
+                vector<double>{caller_utility, -caller_utility} :
+                vector<double>{-caller_utility, caller_utility};
+            next_node->phase_ = Phase::Finished;
+        } else if (action > last_bid_ && action < tables_->n_bids) {
+            next_node->bid_mask_ |= uint64_t(1) << action;
+            next_node->last_bid_ = action;
+        } else {
+            throw logic_error("Illegal action " + to_string(action));
+        }
+        break;
+    }
+    default:
+        throwWrongNodeTypeFnException("applyAction");
+    }
+
+    next_node->calculateProperties();
+    return next_node;
+}
+
+int LiarsDiceNode::getCurrentPlayer() const {
+    if (phase_ != Phase::Bidding) {
+        throwWrongNodeTypeFnException("getCurrentPlayer");
+    }
+    return popcount(bid_mask_) % 2;
+}
+
+size_t LiarsDiceNode::getInfoSetKeyInt() const {
+    // acting player is implied by the number of bids in the mask
+    return (bid_mask_ << tables_->roll_bits) | rolls_[getCurrentPlayer()];
+}
+
+string LiarsDiceNode::getInfoSetKeyString() const {
+    int player = getCurrentPlayer();
+    ostringstream oss;
+    oss << "p" << player << " roll:" << rollToString(rolls_[player]) << " bids:";
+    for (int bid = 0; bid <= last_bid_; bid++) {
+        if (bid_mask_ & (uint64_t(1) << bid)) {
+            oss << " " << bidToString(bid);
+        }
+    }
+    return oss.str();
+}
+
+string LiarsDiceNode::toString() const {
+    ostringstream oss;
+    oss << getTypeString();
+    if (phase_ != Phase::Deal) {
+        oss << " rolls: " << rollToString(rolls_[0]) << " | " << rollToString(rolls_[1]);
+    }
+    if (last_bid_ >= 0) {
+        oss << " last bid: " << bidToString(last_bid_);
+    }
+    return oss.str();
+}
+
+string LiarsDiceNode::actionToString(int action) const {
+    if (phase_ == Phase::Deal) {
+        int n_rolls = tables_->roll_face_counts.size();
+        return rollToString(action / n_rolls) + " | " + rollToString(action % n_rolls);
+    }
+    if (action == getLiarAction()) {
+        return "liar";
+    }
+    return bidToString(action);
+}
+
+string LiarsDiceNode::bidToString(int bid) const {
+    int n_faces = tables_->params.n_faces;
+    return to_string(bid / n_faces + 1) + "x" + to_string(bid % n_faces + 1);
+}
+
+string LiarsDiceNode::rollToString(int roll_idx) const {
+    const vector<int>& face_counts = tables_->roll_face_counts[roll_idx];
+    string result;
+    for (size_t face = 0; face < face_counts.size(); face++) {
+        result.append(face_counts[face], '1' + face);
+    }
+    return result;
+}
+
+const LiarsDiceNode::Params& LiarsDiceNode::getParams() const {
+    return tables_->params;
+}
+
+int LiarsDiceNode::getNumBids() const {
+    return tables_->n_bids;
+}
+
+int LiarsDiceNode::getLiarAction() const {
+    return tables_->n_bids;
+}
+
+int LiarsDiceNode::getRollCount() const {
+    return tables_->roll_face_counts.size();
+}
+
+const vector<double>& LiarsDiceNode::getDealProbabilities() const {
+    return tables_->root_probabilities;
+}
+
+int LiarsDiceNode::getLastBid() const {
+    return last_bid_;
+}
+
+LiarsDiceNode LiarsDiceNode::withRolls(int roll_0, int roll_1) const {
+    if (phase_ == Phase::Finished) {
+        throw logic_error("Rolls of a finished game cannot be replaced");
+    }
+    int n_rolls = getRollCount();
+    if (roll_0 < 0 || roll_0 >= n_rolls || roll_1 < 0 || roll_1 >= n_rolls) {
+        throw out_of_range("Roll index out of range");
+    }
+    LiarsDiceNode node = *this;
+    node.rolls_[0] = roll_0;
+    node.rolls_[1] = roll_1;
+    node.phase_ = Phase::Bidding;
+    node.calculateProperties();
+    return node;
+}
@@ -0,0 +1,90 @@
+#include "liars_dice/LiarsDicePublicNode.h"
+
+
+LiarsDicePublicNode::LiarsDicePublicNode()
+    : LiarsDicePublicNode(LiarsDiceNode::Params())
+{ }
+
+LiarsDicePublicNode::LiarsDicePublicNode(const LiarsDiceNode::Params& params)
+    // skip the deal, rolls are filled in per private state
+    : node_(LiarsDiceNode(params).withRolls(0, 0)),
+    liar_called_(false)
+{ }
+
+LiarsDicePublicNode::LiarsDicePublicNode(const LiarsDiceNode& bidding_node, bool liar_called)
+    : node_(bidding_node),
+    liar_called_(liar_called)
+{ }
+
+GameNode::Type LiarsDicePublicNode::getType() const {
+    return liar_called_ ? GameNode::Type::Terminal : GameNode::Type::Decision;
+}
+
+size_t LiarsDicePublicNode::getPrivateStateCount(int) const {
+    // both players roll the same number of dice
+    return node_.getRollCount();
+}
+
+const vector<double>& LiarsDicePublicNode::getPrivateStatePrior() const {
+    // the deal outcome roll_0 * n_rolls + roll_1 has the same layout
+    return node_.getDealProbabilities();
+}
+
+vector<double> LiarsDicePublicNode::getTerminalUtilityMatrix(int player) const {
+    if (!liar_called_) {
+        throwWrongNodeTypeFnException("getTerminalUtilityMatrix");
+    }
+    int n_rolls = node_.getRollCount();
+    vector<double> utilities(n_rolls * n_rolls);
+
+    for (int roll_0 = 0; roll_0 < n_rolls; roll_0++) {
+        for (int roll_1 = 0; roll_1 < n_rolls; roll_1++) {
+            LiarsDiceNode node = node_.withRolls(roll_0, roll_1);
+            utilities[roll_0 * n_rolls + roll_1] =
+                node.applyAction(node.getLiarAction())->getTerminalUtilities()[player];
+        }
+    }
+    return utilities;
+}
+
+int LiarsDicePublicNode::getCurrentPlayer() const {
+    if (liar_called_) {
+        throwWrongNodeTypeFnException("getCurrentPlayer");
+    }
+    return node_.getCurrentPlayer();
+}
+
+const vector<int>& LiarsDicePublicNode::getLegalActions() const {
+    if (liar_called_) {
+        throwWrongNodeTypeFnException("getLegalActions");
+    }
+    return node_.getLegalActions();
+}
+
+shared_ptr<const PublicTreeNode> LiarsDicePublicNode::applyAction(int action) const {
+    if (liar_called_) {
+        throwWrongNodeTypeFnException("applyAction");
+    }
+    if (action == node_.getLiarAction()) {
+        if (node_.getLastBid() < 0) {
+            throw logic_error("Illegal action " + to_string(action));
+        }
+        return shared_ptr<const PublicTreeNode>(new LiarsDicePublicNode(node_, true));
+    }
+    auto next_node = static_pointer_cast<const LiarsDiceNode>(node_.applyAction(action));
+    return shared_ptr<const PublicTreeNode>(new LiarsDicePublicNode(*next_node, false));
+}
+
+string LiarsDicePublicNode::getInfoSetKeyString(size_t private_state) const {
+    return withOwnRoll(private_state).getInfoSetKeyString();
+}
+
+size_t LiarsDicePublicNode::getInfoSetKeyInt(size_t private_state) const {
+    return withOwnRoll(private_state).getInfoSetKeyInt();
+}
+
+LiarsDiceNode LiarsDicePublicNode::withOwnRoll(size_t private_state) const {
+    // the key does not depend on the opponent's roll
+    int roll = private_state;
+    return getCurrentPlayer() == 0 ? node_.withRolls(roll, 0) : node_.withRolls(0, roll);
+}
@@ -73,4 +73,20 @@ size_t PyGameNode::getInfoSetKeyInt() const {
         GameNode,            // Parent class
         getInfoSetKeyInt     // Function name
     );
-}
\ No newline at end of file
+}
+
+bool PyGameNode::hasStateHash() const {
+    PYBIND11_OVERRIDE(
+        bool,                // Return type
+        GameNode,            // Parent class
+        hasStateHash         // Function name
+    );
+}
+
+uint64_t PyGameNode::getStateHash() const {
+    PYBIND11_OVERRIDE(
+        uint64_t,            // Return type
+        GameNode,            // Parent class
+        getStateHash         // Function name
+    );
+}
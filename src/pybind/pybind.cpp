@@ -2,23 +2,504 @@
 #include <pybind11/stl.h>
 #include <pybind11/functional.h>
 #include <pybind11/operators.h>
+#include <pybind11/numpy.h>
 #include <memory>
+#include <stdexcept>
+#include <stop_token>
 
 #include "cfr/CFRPlus.h"
+#include "cfr/VectorCFR.h"
+#include "cfr/HogwildMCCFR.h"
+#include "cfr/ShardedCFR.h"
+#include "cfr/OutOfCoreCFR.h"
+#include "cfr/MultiRootCFR.h"
 #include "abstract/infoset/InfoSet.h"
 #include "abstract/infoset/InfoSetMap.h"
 #include "abstract/infoset/InfoSetUtils.h"
 #include "abstract/nodes/GameNode.h"
+#include "abstract/nodes/PublicTreeNode.h"
+#include "abstract/strategy/PolicyTable.h"
+#include "abstract/strategy/ActionSampler.h"
+#include "abstract/strategy/Simulator.h"
+#include "abstract/strategy/BestResponse.h"
+#include "abstract/strategy/LocalBestResponse.h"
+#include "abstract/strategy/HeadToHead.h"
+#include "abstract/strategy/Utils.h"
 #include "abstract/nodes/Randomizer.h"
 #include "tictactoe/TicTacToeBoard.h"
 #include "tictactoe/TicTacToeNode.h"
 #include "tictactoe/TTTInvariant.h"
+#include "synthetic/SyntheticGameNode.h"
+#include "goofspiel/GoofspielNode.h"
+#include "liars_dice/LiarsDiceNode.h"
+#include "liars_dice/LiarsDicePublicNode.h"
+#include "tabular/TabularGame.h"
+#include "tabular/EfgReader.h"
+#include "tabular/Tabularizer.h"
 #include "pybind/PyGameNode.h"
 #include "Utils.h"
 
 namespace py = pybind11;
 using namespace std;
 
+
+// numpy array over C++ owned memory, owner keeps the memory alive
+template <typename T>
+py::array_t<T> arrayView(const vector<T>& values, py::handle owner) {
+    return py::array_t<T>(values.size(), values.data(), owner);
+}
+
+// value arrays are exposed as views, not copies
+template <InfoSetKey Key>
+void bindInfoSetArrays(py::module_& m, const char* name) {
+    using Arrays = infoset_utils::InfoSetArrays<Key>;
+
+    auto view_property = [](vector<double> Arrays::* field) {
+        return [field](py::object self) {
+            return arrayView(self.cast<const Arrays&>().*field, self);
+        };
+    };
+
+    py::class_<Arrays>(m, name)
+        .def("__len__", [](const Arrays& arrays) { return arrays.keys.size(); })
+        .def_property_readonly("keys", [](py::object self) -> py::object {
+            const Arrays& arrays = self.cast<const Arrays&>();
+            if constexpr (is_same_v<Key, size_t>) {
+                return arrayView(arrays.keys, self);
+            } else {
+                return py::cast(arrays.keys);
+            }
+        })
+        .def_property_readonly("offsets", [](py::object self) {
+            return arrayView(self.cast<const Arrays&>().offsets, self);
+        })
+        .def_property_readonly("instant_regret", view_property(&Arrays::instant_regret))
+        .def_property_readonly("regret_sum", view_property(&Arrays::regret_sum))
+        .def_property_readonly("strategy_sum", view_property(&Arrays::strategy_sum))
+        .def_property_readonly("average_strategy", view_property(&Arrays::average_strategy));
+}
+
+
+// batch lookup returns (strategies[n_keys, max_actions], n_actions[n_keys])
+template <InfoSetKey Key>
+py::tuple policyTableLookup(const PolicyTable<Key>& table, span<const Key> keys) {
+    size_t row_width = table.getMaxActions();
+    py::array_t<double> strategies({keys.size(), row_width});
+    py::array_t<size_t> n_actions(keys.size());
+    span<double> strategies_out(strategies.mutable_data(), keys.size() * row_width);
+    span<size_t> n_actions_out(n_actions.mutable_data(), keys.size());
+    {
+        py::gil_scoped_release release;
+        table.getStrategies(keys, strategies_out, row_width, n_actions_out);
+    }
+    return py::make_tuple(strategies, n_actions);
+}
+
+template <InfoSetKey Key>
+void bindPolicyTable(py::module_& m, const char* name) {
+    auto policy_table = py::class_<PolicyTable<Key>, shared_ptr<PolicyTable<Key>>>(m, name)
+        .def(py::init<const InfoSetMap<Key>&>(), py::arg("infoset_map"))
+        .def("__len__", &PolicyTable<Key>::size)
+        .def("__contains__", &PolicyTable<Key>::contains)
+        .def("getMaxActions", &PolicyTable<Key>::getMaxActions)
+        .def("getStrategy", [](py::object self, const Key& key) {
+            span<const double> strategy = self.cast<const PolicyTable<Key>&>().getStrategy(key);
+            return py::array_t<double>(strategy.size(), strategy.data(), self);
+        });
+
+    if constexpr (is_same_v<Key, size_t>) {
+        policy_table.def("lookup", [](
+            const PolicyTable<Key>& table,
+            py::array_t<size_t, py::array::c_style | py::array::forcecast> keys
+        ) {
+            return policyTableLookup(table, span<const size_t>(keys.data(), keys.size()));
+        }, py::arg("keys"));
+    } else {
+        policy_table.def("lookup", [](
+            const PolicyTable<Key>& table,
+            const vector<string>& keys
+        ) {
+            return policyTableLookup(table, span<const string>(keys));
+        }, py::arg("keys"));
+    }
+}
+
+
+template <InfoSetKey Key>
+void bindActionSampler(py::module_& m, const char* name) {
+    auto action_sampler = py::class_<ActionSampler<Key>>(m, name)
+        .def(py::init([](shared_ptr<PolicyTable<Key>> policy_table) {
+            return ActionSampler<Key>(policy_table);
+        }), py::arg("policy_table"));
+
+    // returns action indices, -1 for unknown keys
+    auto sample_batch = [](
+        const ActionSampler<Key>& sampler,
+        span<const Key> keys,
+        uint64_t seed, uint64_t stream, uint64_t start_counter
+    ) {
+        py::array_t<int> actions(keys.size());
+        span<int> actions_out(actions.mutable_data(), keys.size());
+        {
+            py::gil_scoped_release release;
+            sampler.sampleBatch(keys, actions_out, seed, stream, start_counter);
+        }
+        return actions;
+    };
+
+    if constexpr (is_same_v<Key, size_t>) {
+        action_sampler.def("sampleBatch", [sample_batch](
+            const ActionSampler<Key>& sampler,
+            py::array_t<size_t, py::array::c_style | py::array::forcecast> keys,
+            uint64_t seed, uint64_t stream, uint64_t start_counter
+        ) {
+            return sample_batch(
+                sampler, span<const size_t>(keys.data(), keys.size()),
+                seed, stream, start_counter
+            );
+        }, py::arg("keys"), py::arg("seed"), py::arg("stream") = 0, py::arg("start_counter") = 0);
+    } else {
+        action_sampler.def("sampleBatch", [sample_batch](
+            const ActionSampler<Key>& sampler,
+            const vector<string>& keys,
+            uint64_t seed, uint64_t stream, uint64_t start_counter
+        ) {
+            return sample_batch(sampler, span<const string>(keys), seed, stream, start_counter);
+        }, py::arg("keys"), py::arg("seed"), py::arg("stream") = 0, py::arg("start_counter") = 0);
+    }
+}
+
+
+template <InfoSetKey Key>
+void bindSimulator(py::module_& m, const char* name) {
+    using Result = typename Simulator<Key>::Result;
+
+    auto simulator = py::class_<Simulator<Key>>(m, name)
+        .def(py::init([](
+            shared_ptr<const GameNode> root,
+            const vector<shared_ptr<PolicyTable<Key>>>& player_policies,
+            MissingInfoSet missing_infoset
+        ) {
+            vector<shared_ptr<const PolicyTable<Key>>> policies(
+                player_policies.begin(), player_policies.end()
+            );
+            return Simulator<Key>(root, policies, missing_infoset);
+        }), py::arg("root"), py::arg("player_policies"),
+            py::arg("missing_infoset") = MissingInfoSet::Throw)
+        .def("run", &Simulator<Key>::run,
+             py::arg("n_games"), py::arg("seed"), py::arg("n_threads") = 0,
+             py::call_guard<py::gil_scoped_release>())
+        .def("playGame", &Simulator<Key>::playGame, py::arg("seed"), py::arg("game_idx"));
+
+    py::class_<Result>(simulator, "Result")
+        .def_readonly("n_games", &Result::n_games)
+        .def_readonly("mean_utilities", &Result::mean_utilities)
+        .def_readonly("standard_errors", &Result::standard_errors)
+        .def_readonly("confidence_95", &Result::confidence_95);
+}
+
+
+template <typename Key>
+void bindBestResponse(py::module_& m, const char* name) {
+    using Result = typename BestResponse<Key>::Result;
+
+    auto best_response = py::class_<BestResponse<Key>>(m, name)
+        .def(py::init<shared_ptr<const GameNode>, MissingInfoSet>(),
+             py::arg("root"), py::arg("missing_infoset") = MissingInfoSet::Throw)
+        .def("compute",
+             py::overload_cast<const PolicyTable<Key>&, int>(&BestResponse<Key>::compute, py::const_),
+             py::arg("policy"), py::arg("n_threads") = 0,
+             py::call_guard<py::gil_scoped_release>())
+        .def("compute",
+             py::overload_cast<const InfoSetMap<Key>&, int>(&BestResponse<Key>::compute, py::const_),
+             py::arg("strategy"), py::arg("n_threads") = 0,
+             py::call_guard<py::gil_scoped_release>())
+        .def("getPlayerCount", &BestResponse<Key>::getPlayerCount)
+        .def("getNodeCount", &BestResponse<Key>::getNodeCount)
+        .def("getInfoSetCount", &BestResponse<Key>::getInfoSetCount);
+
+    py::class_<Result>(best_response, "Result")
+        .def_readonly("best_response_values", &Result::best_response_values)
+        .def_readonly("strategy_values", &Result::strategy_values)
+        .def_readonly("nash_conv", &Result::nash_conv)
+        .def_readonly("exploitability", &Result::exploitability);
+}
+
+
+template <typename Key>
+void bindLocalBestResponse(py::module_& m, const char* name) {
+    using LBR = LocalBestResponse<Key>;
+    using Params = typename LBR::Params;
+    using Result = typename LBR::Result;
+    using Estimate = typename LBR::ExploitabilityEstimate;
+
+    auto lbr = py::class_<LBR>(m, name);
+
+    py::class_<Params>(lbr, "Params")
+        .def(py::init<>())
+        .def_readwrite("n_particles", &Params::n_particles)
+        .def_readwrite("n_rollouts", &Params::n_rollouts)
+        .def_readwrite("n_resample_histories", &Params::n_resample_histories);
+
+    py::class_<Result>(lbr, "Result")
+        .def_readonly("exploiter", &Result::exploiter)
+        .def_readonly("n_games", &Result::n_games)
+        .def_readonly("mean_value", &Result::mean_value)
+        .def_readonly("standard_error", &Result::standard_error)
+        .def_readonly("confidence_95", &Result::confidence_95)
+        .def_readonly("n_belief_failures", &Result::n_belief_failures);
+
+    py::class_<Estimate>(lbr, "ExploitabilityEstimate")
+        .def_readonly("players", &Estimate::players)
+        .def_readonly("exploitability", &Estimate::exploitability)
+        .def_readonly("confidence_95", &Estimate::confidence_95);
+
+    lbr
+        .def(py::init([](
+            shared_ptr<const GameNode> root,
+            shared_ptr<PolicyTable<Key>> policy,
+            Params params,
+            MissingInfoSet missing_infoset
+        ) {
+            return LBR(root, policy, params, missing_infoset);
+        }), py::arg("root"), py::arg("policy"), py::arg("params") = Params(),
+            py::arg("missing_infoset") = MissingInfoSet::Throw)
+        .def("run", &LBR::run,
+             py::arg("exploiter"), py::arg("n_games"), py::arg("seed"), py::arg("n_threads") = 0,
+             py::call_guard<py::gil_scoped_release>())
+        .def("estimateExploitability", &LBR::estimateExploitability,
+             py::arg("n_games"), py::arg("seed"), py::arg("n_threads") = 0,
+             py::call_guard<py::gil_scoped_release>());
+}
+
+
+template <typename Key>
+void bindHeadToHead(py::module_& m, const char* name) {
+    // Python holds tables as shared_ptr<PolicyTable>, converted to const here
+    using Policies = vector<shared_ptr<PolicyTable<Key>>>;
+    auto toConst = [](const Policies& policies) {
+        return vector<shared_ptr<const PolicyTable<Key>>>(policies.begin(), policies.end());
+    };
+
+    py::class_<HeadToHead<Key>>(m, name)
+        .def(py::init<shared_ptr<const GameNode>, MissingInfoSet>(),
+             py::arg("root"), py::arg("missing_infoset") = MissingInfoSet::Throw)
+        .def("evaluate", [toConst](const HeadToHead<Key>& h2h, const Policies& player_policies) {
+            auto policies = toConst(player_policies);
+            py::gil_scoped_release release;
+            return h2h.evaluate(policies);
+        }, py::arg("player_policies"))
+        .def("evaluateMatrix", [toConst](
+            const HeadToHead<Key>& h2h, const Policies& policies, int n_threads
+        ) {
+            auto const_policies = toConst(policies);
+            py::gil_scoped_release release;
+            return h2h.evaluateMatrix(const_policies, n_threads);
+        }, py::arg("policies"), py::arg("n_threads") = 0)
+        .def("getPlayerCount", &HeadToHead<Key>::getPlayerCount)
+        .def("getNodeCount", &HeadToHead<Key>::getNodeCount)
+        .def("getInfoSetCount", &HeadToHead<Key>::getInfoSetCount);
+}
+
+
+template <typename ISKey>
+void bindMemoizedEvaluation(py::module_& m, const char* class_name, const char* fn_name) {
+    using Evaluation = strategy_utils::MemoizedEvaluation<ISKey>;
+
+    py::class_<Evaluation>(m, class_name)
+        .def_readonly("root_value", &Evaluation::root_value)
+        .def_readonly("infoset_values", &Evaluation::infoset_values)
+        .def_readonly("n_evaluated_states", &Evaluation::n_evaluated_states)
+        .def_readonly("n_cache_hits", &Evaluation::n_cache_hits);
+
+    m.def(fn_name, &strategy_utils::evaluateNodeMemoized<ISKey>,
+          py::arg("node"), py::arg("infoset_strategy"),
+          py::arg("max_cached_states") = 1 << 20,
+          py::arg("compute_infoset_values") = false,
+          py::call_guard<py::gil_scoped_release>());
+}
+
+
+template <InfoSetKey Key>
+void bindVectorCFR(py::module_& m, const char* name) {
+    py::class_<VectorCFR<Key>>(m, name)
+        .def(py::init<shared_ptr<const PublicTreeNode>, const InfoSetMap<Key>&>(),
+             py::arg("root"), py::arg("initial_state") = InfoSetMap<Key>())
+        .def("evaluateAndUpdate", &VectorCFR<Key>::evaluateAndUpdateRegretSum,
+             py::arg("accumulate_regsum") = true, py::arg("accumulate_strategy") = true,
+             py::call_guard<py::gil_scoped_release>())
+        .def("evaluate", &VectorCFR<Key>::evaluateRegretSum,
+             py::call_guard<py::gil_scoped_release>())
+        .def("getStrategyInfoSets", &VectorCFR<Key>::getStrategyInfoSets,
+             py::return_value_policy::reference_internal)
+        .def("exportArrays", [](const VectorCFR<Key>& cfr) {
+            return infoset_utils::toArrays(cfr.getStrategyInfoSets());
+        })
+        .def("buildPolicyTable", [](const VectorCFR<Key>& cfr) {
+            return PolicyTable<Key>(cfr.getStrategyInfoSets());
+        })
+        .def("getPublicNodeCount", &VectorCFR<Key>::getPublicNodeCount)
+        .def("getTerminalMatrixCount", &VectorCFR<Key>::getTerminalMatrixCount);
+}
+
+
+template <InfoSetKey Key>
+void bindHogwildMCCFR(py::module_& m, const char* name) {
+    py::class_<HogwildMCCFR<Key>>(m, name)
+        .def(py::init<shared_ptr<const GameNode>, size_t, uint64_t>(),
+             py::arg("root_node"), py::arg("infoset_capacity") = size_t(1) << 20,
+             py::arg("seed") = 0)
+        .def("train", &HogwildMCCFR<Key>::train,
+             py::arg("n_iterations"), py::arg("n_threads") = 0,
+             py::call_guard<py::gil_scoped_release>())
+        .def("getIterationCount", &HogwildMCCFR<Key>::getIterationCount)
+        .def("getPlayerCount", &HogwildMCCFR<Key>::getPlayerCount)
+        .def("getInfoSetCount", [](const HogwildMCCFR<Key>& cfr) {
+            return cfr.getTable().size();
+        })
+        .def("getStrategyInfoSets", &HogwildMCCFR<Key>::getStrategyInfoSets)
+        .def("buildPolicyTable", [](const HogwildMCCFR<Key>& cfr) {
+            return PolicyTable<Key>(cfr.getStrategyInfoSets());
+        });
+}
+
+
+template <InfoSetKey Key>
+void bindShardedCFR(py::module_& m, const char* name) {
+    py::class_<ShardedCFR<Key>>(m, name)
+        // workers are forked without the GIL and must not run Python code
+        .def(py::init([](
+            shared_ptr<const GameNode> root_node,
+            int n_workers,
+            const InfoSetMap<Key>& initial_state
+        ) {
+            if (dynamic_pointer_cast<const PyGameNode>(root_node)) {
+                throw invalid_argument("ShardedCFR only supports games implemented in C++");
+            }
+            return make_unique<ShardedCFR<Key>>(root_node, n_workers, initial_state);
+        }), py::arg("root_node"), py::arg("n_workers"),
+            py::arg("initial_state") = InfoSetMap<Key>())
+        .def("train", &ShardedCFR<Key>::train, py::arg("n_iterations"),
+             py::call_guard<py::gil_scoped_release>())
+        .def("getStrategyInfoSets", &ShardedCFR<Key>::getStrategyInfoSets)
+        .def("buildPolicyTable", [](const ShardedCFR<Key>& cfr) {
+            return PolicyTable<Key>(cfr.getStrategyInfoSets());
+        })
+        .def("getWorkerCount", &ShardedCFR<Key>::getWorkerCount)
+        .def("getInfoSetCount", &ShardedCFR<Key>::getInfoSetCount)
+        .def("getShardSize", &ShardedCFR<Key>::getShardSize, py::arg("worker"))
+        .def("getWorkItemCount", &ShardedCFR<Key>::getWorkItemCount);
+}
+
+
+template <InfoSetKey Key>
+void bindMultiRootCFR(py::module_& m, const char* name) {
+    py::class_<MultiRootCFR<Key>>(m, name)
+        // the Python dict is copied once, the solver then owns the map
+        .def(py::init([](const vector<shared_ptr<const GameNode>>& roots,
+                         const vector<double>& weights, int n_threads,
+                         const InfoSetMap<Key>& initial_state) {
+                 return new MultiRootCFR<Key>(
+                     roots, weights, n_threads, make_shared<InfoSetMap<Key>>(initial_state)
+                 );
+             }),
+             py::arg("roots"), py::arg("weights"), py::arg("n_threads") = 0,
+             py::arg("initial_state") = InfoSetMap<Key>())
+        .def("evaluateAndUpdate", &MultiRootCFR<Key>::evaluateAndUpdateRegretSum,
+             py::arg("accumulate_regsum") = true, py::arg("accumulate_strategy") = true,
+             py::call_guard<py::gil_scoped_release>())
+        .def("evaluate", &MultiRootCFR<Key>::evaluateRegretSum,
+             py::call_guard<py::gil_scoped_release>())
+        .def("getRootCount", &MultiRootCFR<Key>::getRootCount)
+        .def("getWeightedValue", &MultiRootCFR<Key>::getWeightedValue)
+        .def("getStrategyInfoSets", &MultiRootCFR<Key>::getStrategyInfoSets,
+             py::return_value_policy::reference_internal)
+        .def("getSolver", &MultiRootCFR<Key>::getSolver,
+             py::return_value_policy::reference_internal);
+}
+
+template <InfoSetKey Key>
+void bindOutOfCoreCFR(py::module_& m, const char* name) {
+    using Params = typename InfoSetStore<Key>::Params;
+    using Statistics = typename InfoSetStore<Key>::Statistics;
+
+    auto out_of_core = py::class_<OutOfCoreCFR<Key>>(m, name)
+        .def(py::init<shared_ptr<const GameNode>, const Params&, const InfoSetMap<Key>&>(),
+             py::arg("root_node"), py::arg("store_params") = Params(),
+             py::arg("initial_state") = InfoSetMap<Key>())
+        .def("evaluateAndUpdate", &OutOfCoreCFR<Key>::evaluateAndUpdateRegretSum,
+             py::arg("accumulate_regsum") = true, py::arg("accumulate_strategy") = true,
+             py::call_guard<py::gil_scoped_release>())
+        .def("evaluate", &OutOfCoreCFR<Key>::evaluateRegretSum,
+             py::call_guard<py::gil_scoped_release>())
+        .def("getStatistics", &OutOfCoreCFR<Key>::getStatistics)
+        .def("getStrategyInfoSets", &OutOfCoreCFR<Key>::getStrategyInfoSets);
+
+    py::class_<Params>(out_of_core, "StoreParams")
+        .def(py::init<>())
+        .def_readwrite("memory_budget_bytes", &Params::memory_budget_bytes)
+        .def_readwrite("segment_bytes", &Params::segment_bytes)
+        .def_readwrite("directory", &Params::directory);
+
+    py::class_<Statistics>(out_of_core, "Statistics")
+        .def_readonly("n_infosets", &Statistics::n_infosets)
+        .def_readonly("file_bytes", &Statistics::file_bytes)
+        .def_readonly("resident_segments", &Statistics::resident_segments)
+        .def_readonly("spilled_segments", &Statistics::spilled_segments)
+        .def_readonly("n_accesses", &Statistics::n_accesses)
+        .def_readonly("n_faults", &Statistics::n_faults)
+        .def_readonly("n_evictions", &Statistics::n_evictions)
+        .def_readonly("n_prefetches", &Statistics::n_prefetches)
+        .def_readonly("fault_rate", &Statistics::fault_rate);
+}
+
+
+// train() runs without the GIL, only the throttled callback re-acquires it
+// (Python-defined nodes re-acquire it on their own for every call)
+template <typename ISKey>
+void bindTraining(py::class_<CFRPlus<ISKey>>& cfr_class) {
+    using Progress = typename CFRPlus<ISKey>::TrainingProgress;
+
+    py::class_<Progress>(cfr_class, "TrainingProgress")
+        .def_readonly("iteration", &Progress::iteration)
+        .def_readonly("n_iterations", &Progress::n_iterations)
+        .def_readonly("root_value", &Progress::root_value)
+        .def_readonly("metric", &Progress::metric);
+
+    cfr_class.def("train", [](
+        CFRPlus<ISKey>& cfr,
+        int n_iterations,
+        int strategy_delay,
+        py::object callback,
+        double callback_interval_seconds,
+        stop_source* stop
+    ) {
+        typename CFRPlus<ISKey>::ProgressCallback progress_callback;
+        if (!callback.is_none()) {
+            progress_callback = [callback](const Progress& progress) {
+                py::gil_scoped_acquire gil;
+                if (PyErr_CheckSignals() != 0) {
+                    throw py::error_already_set();
+                }
+                py::object result = callback(progress);
+                // returning None from the callback means "continue"
+                return result.is_none() || result.cast<bool>();
+            };
+        }
+        stop_token token = stop ? stop->get_token() : stop_token();
+
+        py::gil_scoped_release release;
+        return cfr.train(
+            n_iterations, strategy_delay, progress_callback,
+            callback_interval_seconds, token
+        );
+    },
+    py::arg("n_iterations"), py::arg("strategy_delay") = 0,
+    py::arg("callback") = py::none(), py::arg("callback_interval_seconds") = 1.0,
+    py::arg("stop_source") = py::none(),
+    "Run n_iterations of CFR+ natively, returns the number of completed iterations");
+}
+
 PYBIND11_MODULE(game_algorithms_py, m) {
     m.doc() = "Game algorithms library";
 
@@ -41,7 +522,9 @@ PYBIND11_MODULE(game_algorithms_py, m) {
         .def("applyAction", &GameNode::applyAction)
         .def("getCurrentPlayer", &GameNode::getCurrentPlayer)
         .def("getInfoSetKeyString", &GameNode::getInfoSetKeyString)
-        .def("getInfoSetKeyInt", &GameNode::getInfoSetKeyInt);
+        .def("getInfoSetKeyInt", &GameNode::getInfoSetKeyInt)
+        .def("hasStateHash", &GameNode::hasStateHash)
+        .def("getStateHash", &GameNode::getStateHash);
 
     // TicTacToeBoard
     py::class_<TicTacToeBoard>(m, "TicTacToeBoard")
@@ -89,6 +572,112 @@ PYBIND11_MODULE(game_algorithms_py, m) {
         .def(py::init<>())
         .def(py::init<const TicTacToeNode&>());
 
+    // SyntheticGameNode
+    auto synthetic_node = py::class_<SyntheticGameNode, GameNode, shared_ptr<SyntheticGameNode>>(
+        m, "SyntheticGameNode");
+
+    py::class_<SyntheticGameNode::Params>(synthetic_node, "Params")
+        .def(py::init<>())
+        .def_readwrite("seed", &SyntheticGameNode::Params::seed)
+        .def_readwrite("n_players", &SyntheticGameNode::Params::n_players)
+        .def_readwrite("max_depth", &SyntheticGameNode::Params::max_depth)
+        .def_readwrite("min_actions", &SyntheticGameNode::Params::min_actions)
+        .def_readwrite("max_actions", &SyntheticGameNode::Params::max_actions)
+        .def_readwrite("chance_node_probability", &SyntheticGameNode::Params::chance_node_probability)
+        .def_readwrite("n_chance_outcomes", &SyntheticGameNode::Params::n_chance_outcomes)
+        .def_readwrite("terminal_probability", &SyntheticGameNode::Params::terminal_probability)
+        .def_readwrite("infosets_per_depth", &SyntheticGameNode::Params::infosets_per_depth)
+        .def_readwrite("zero_sum", &SyntheticGameNode::Params::zero_sum);
+
+    synthetic_node
+        .def(py::init<>())
+        .def(py::init<const SyntheticGameNode::Params&>(), py::arg("params"))
+        .def("getParams", &SyntheticGameNode::getParams,
+             py::return_value_policy::reference_internal)
+        .def("getDepth", &SyntheticGameNode::getDepth)
+        .def("getPathHash", &SyntheticGameNode::getPathHash);
+
+    // GoofspielNode
+    auto goofspiel_node = py::class_<GoofspielNode, GameNode, shared_ptr<GoofspielNode>>(
+        m, "GoofspielNode");
+
+    py::enum_<GoofspielNode::PrizeOrder>(goofspiel_node, "PrizeOrder")
+        .value("Random", GoofspielNode::PrizeOrder::Random)
+        .value("Ascending", GoofspielNode::PrizeOrder::Ascending)
+        .value("Descending", GoofspielNode::PrizeOrder::Descending);
+
+    py::class_<GoofspielNode::Params>(goofspiel_node, "Params")
+        .def(py::init<>())
+        .def_readwrite("n_cards", &GoofspielNode::Params::n_cards)
+        .def_readwrite("prize_order", &GoofspielNode::Params::prize_order)
+        .def_readwrite("win_loss_utility", &GoofspielNode::Params::win_loss_utility);
+
+    goofspiel_node
+        .def(py::init<>())
+        .def(py::init<const GoofspielNode::Params&>(), py::arg("params"))
+        .def("getParams", &GoofspielNode::getParams,
+             py::return_value_policy::reference_internal)
+        .def("getRound", &GoofspielNode::getRound)
+        .def("getPoints", &GoofspielNode::getPoints);
+
+    // LiarsDiceNode
+    auto liars_dice_node = py::class_<LiarsDiceNode, GameNode, shared_ptr<LiarsDiceNode>>(
+        m, "LiarsDiceNode");
+
+    py::class_<LiarsDiceNode::Params>(liars_dice_node, "Params")
+        .def(py::init<>())
+        .def_readwrite("dice_per_player", &LiarsDiceNode::Params::dice_per_player)
+        .def_readwrite("n_faces", &LiarsDiceNode::Params::n_faces)
+        .def_readwrite("highest_face_wild", &LiarsDiceNode::Params::highest_face_wild);
+
+    liars_dice_node
+        .def(py::init<>())
+        .def(py::init<const LiarsDiceNode::Params&>(), py::arg("params"))
+        .def("getParams", &LiarsDiceNode::getParams,
+             py::return_value_policy::reference_internal)
+        .def("getNumBids", &LiarsDiceNode::getNumBids)
+        .def("getLiarAction", &LiarsDiceNode::getLiarAction);
+
+    // Public tree nodes for vector-form solvers
+    py::class_<PublicTreeNode, shared_ptr<PublicTreeNode>>(m, "PublicTreeNode")
+        .def("getType", &PublicTreeNode::getType)
+        .def("getTypeString", &PublicTreeNode::getTypeString)
+        .def("getPrivateStateCount", &PublicTreeNode::getPrivateStateCount)
+        .def("getPrivateStatePrior", &PublicTreeNode::getPrivateStatePrior)
+        .def("getTerminalUtilityMatrix", &PublicTreeNode::getTerminalUtilityMatrix)
+        .def("getCurrentPlayer", &PublicTreeNode::getCurrentPlayer)
+        .def("getLegalActions", &PublicTreeNode::getLegalActions)
+        .def("applyAction", &PublicTreeNode::applyAction)
+        .def("getInfoSetKeyString", &PublicTreeNode::getInfoSetKeyString)
+        .def("getInfoSetKeyInt", &PublicTreeNode::getInfoSetKeyInt);
+
+    py::class_<LiarsDicePublicNode, PublicTreeNode, shared_ptr<LiarsDicePublicNode>>(
+        m, "LiarsDicePublicNode")
+        .def(py::init<>())
+        .def(py::init<const LiarsDiceNode::Params&>(), py::arg("params"));
+
+    // TabularGame - held as const by C++, exposed read-only to Python
+    py::class_<TabularGame, shared_ptr<TabularGame>>(m, "TabularGame")
+        .def("getRootNode", &TabularGame::getRootNode)
+        .def("getNode", &TabularGame::getNode)
+        .def("getPlayerCount", &TabularGame::getPlayerCount)
+        .def("getNodeCount", &TabularGame::getNodeCount)
+        .def("getInfoSetCount", &TabularGame::getInfoSetCount);
+
+    m.def("readEfgFile", [](const string& filename) {
+        return const_pointer_cast<TabularGame>(EfgReader::readFile(filename));
+    }, py::arg("filename"), "Read a Gambit .efg file into a TabularGame");
+    m.def("readEfgString", [](const string& content) {
+        return const_pointer_cast<TabularGame>(EfgReader::readString(content));
+    }, py::arg("content"), "Parse Gambit .efg content into a TabularGame");
+
+    // walks a (typically Python-defined) game once, holding the GIL,
+    // solvers then traverse the returned native copy
+    m.def("tabularize", [](shared_ptr<const GameNode> root, int n_players) {
+        return const_pointer_cast<TabularGame>(Tabularizer::tabularize(root, n_players));
+    }, py::arg("root"), py::arg("n_players") = -1,
+    "Freeze a game tree into a native TabularGame");
+
     // Randomizer wrapper classes
     py::class_<RandomizerWrapNode, GameNode, shared_ptr<RandomizerWrapNode>>(m, "RandomizerWrapNode")
         .def(py::init<shared_ptr<const GameNode>, double, int>(),
@@ -111,18 +700,25 @@ PYBIND11_MODULE(game_algorithms_py, m) {
     // InfoSet
     py::class_<InfoSet>(m, "InfoSet")
         .def(py::init<int>())
+        .def(py::init<const vector<double>&, const vector<double>&>(),
+             py::arg("regret_sum"), py::arg("cumulative_strategy_sum"))
         .def(py::init<const InfoSet&>())
         .def("getInstantRegret", &InfoSet::getInstantRegret,
              py::return_value_policy::reference_internal)
         .def("getRegretSum", &InfoSet::getRegretSum,
              py::return_value_policy::reference_internal)
-        .def("getRegretSumStrategy", &InfoSet::getRegretSumStrategy,
+        .def("getRegretSumStrategy", py::overload_cast<>(&InfoSet::getRegretSumStrategy),
+             py::return_value_policy::reference_internal)
+        .def("getCumulativeStrategy", py::overload_cast<>(&InfoSet::getCumulativeStrategy),
              py::return_value_policy::reference_internal)
-        .def("getCumulativeStrategy", &InfoSet::getCumulativeStrategy,
+        .def("getPredictedRegret", &InfoSet::getPredictedRegret,
              py::return_value_policy::reference_internal)
+        .def("getPredictiveStrategy", &InfoSet::getPredictiveStrategy)
         .def("setInstantRegret", &InfoSet::setInstantRegret)
         .def("accumulateRegret", &InfoSet::accumulateRegret)
-        .def("accumulateStrategy", &InfoSet::accumulateStrategy);
+        .def("accumulateStrategy", py::overload_cast<double>(&InfoSet::accumulateStrategy))
+        .def("accumulateStrategy", py::overload_cast<double, const vector<double>&>(
+             &InfoSet::accumulateStrategy));
 
     // InfoSetMap types - factory functions that return new dict instances
     m.def("InfoSetMapStr", []() { return py::dict(); }, "Create a new string-keyed InfoSet dictionary");
@@ -179,22 +775,97 @@ PYBIND11_MODULE(game_algorithms_py, m) {
     m.def("calculateMetricInt", &infoset_utils::calculateMetric<size_t>);
 
 
+    // Cooperative cancellation of train(), can be triggered from any thread
+    py::class_<stop_source>(m, "StopSource")
+        .def(py::init<>())
+        .def("requestStop", [](stop_source& source) { return source.request_stop(); })
+        .def("stopRequested", [](const stop_source& source) { return source.stop_requested(); });
+
+    // Contiguous info set data for NumPy
+    bindInfoSetArrays<string>(m, "InfoSetArraysStr");
+    bindInfoSetArrays<size_t>(m, "InfoSetArraysInt");
+    m.def("toArraysStr", &infoset_utils::toArrays<string>);
+    m.def("toArraysInt", &infoset_utils::toArrays<size_t>);
+
+    // Read-only normalized strategies for serving
+    bindPolicyTable<string>(m, "PolicyTableStr");
+    bindPolicyTable<size_t>(m, "PolicyTableInt");
+    bindActionSampler<string>(m, "ActionSamplerStr");
+    bindActionSampler<size_t>(m, "ActionSamplerInt");
+
+    py::enum_<MissingInfoSet>(m, "MissingInfoSet")
+        .value("Throw", MissingInfoSet::Throw)
+        .value("Uniform", MissingInfoSet::Uniform);
+
+    // Monte Carlo evaluation, runs without the GIL
+    bindSimulator<string>(m, "SimulatorStr");
+    bindSimulator<size_t>(m, "SimulatorInt");
+
+    bindBestResponse<string>(m, "BestResponseStr");
+    bindBestResponse<size_t>(m, "BestResponseInt");
+
+    bindLocalBestResponse<string>(m, "LocalBestResponseStr");
+    bindLocalBestResponse<size_t>(m, "LocalBestResponseInt");
+
+    bindHeadToHead<string>(m, "HeadToHeadStr");
+    bindHeadToHead<size_t>(m, "HeadToHeadInt");
+
+    bindMemoizedEvaluation<string>(m, "MemoizedEvaluationStr", "evaluateNodeMemoizedStr");
+    bindMemoizedEvaluation<size_t>(m, "MemoizedEvaluationInt", "evaluateNodeMemoizedInt");
+
+    bindVectorCFR<string>(m, "VectorCFRStr");
+    bindVectorCFR<size_t>(m, "VectorCFRInt");
+
+    // hogwild training, runs without the GIL
+    bindHogwildMCCFR<string>(m, "HogwildMCCFRStr");
+    bindHogwildMCCFR<size_t>(m, "HogwildMCCFRInt");
+
+    // multi-process training over shared memory, runs without the GIL
+    bindShardedCFR<string>(m, "ShardedCFRStr");
+    bindShardedCFR<size_t>(m, "ShardedCFRInt");
+
+    // CFR+ with info sets spilled to a memory-mapped file
+    bindOutOfCoreCFR<string>(m, "OutOfCoreCFRStr");
+    bindOutOfCoreCFR<size_t>(m, "OutOfCoreCFRInt");
+
+    // CFR+ over several weighted roots sharing one info set map, runs without the GIL
+    bindMultiRootCFR<string>(m, "MultiRootCFRStr");
+    bindMultiRootCFR<size_t>(m, "MultiRootCFRInt");
+
     // CFRPlus classes with nested Builders
     auto cfrplus_str = py::class_<CFRPlus<string>>(m, "CFRPlusStr")
-        .def(py::init<shared_ptr<const GameNode>, bool, double, const InfoSetMap<string>&>(),
+        .def(py::init<shared_ptr<const GameNode>, bool, double, const InfoSetMap<string>&,
+                      bool, bool, uint64_t, bool, int, size_t>(),
              py::arg("root_node"), py::arg("initial_evaluation_run") = true,
              py::arg("e_soft_regsum_strategies") = 0.0,
-             py::arg("initial_state") = InfoSetMap<string>())
-        .def("evaluateAndUpdate", &CFRPlus<string>::evaluateAndUpdate,
+             py::arg("initial_state") = InfoSetMap<string>(),
+             py::arg("predictive") = false,
+             py::arg("chance_sampling") = false,
+             py::arg("seed") = 0,
+             py::arg("parallel") = false,
+             py::arg("n_threads") = 0,
+             py::arg("infoset_capacity_hint") = 0)
+        .def("evaluateAndUpdate", &CFRPlus<string>::evaluateAndUpdateRegretSum,
              py::arg("accumulate_regsum") = true, py::arg("accumulate_strategy") = true)
-        .def("evaluate", &CFRPlus<string>::evaluate)
+        .def("evaluate", &CFRPlus<string>::evaluateRegretSum)
         .def("getStrategyInfoSets", &CFRPlus<string>::getStrategyInfoSets,
              py::return_value_policy::reference_internal)
+        .def("getCreatedInfoSetCount", &CFRPlus<string>::getCreatedInfoSetCount)
+        .def("getRootOutcomeValues", &CFRPlus<string>::getRootOutcomeValues)
+        // avoids converting the whole map into a Python dict
+        .def("exportArrays", [](CFRPlus<string>& cfr) {
+            return infoset_utils::toArrays(cfr.getStrategyInfoSets());
+        })
+        .def("buildPolicyTable", [](CFRPlus<string>& cfr) {
+            return PolicyTable<string>(cfr.getStrategyInfoSets());
+        })
         .def("processNode", &CFRPlus<string>::processNode,
              py::arg("node"), py::arg("p_past_actions_p0") = 1.0,
              py::arg("p_past_actions_p1") = 1.0, py::arg("p_past_chances") = 1.0,
              py::arg("accumulate_regsum") = false, py::arg("accumulate_strategy") = false);
 
+    bindTraining(cfrplus_str);
+
     py::class_<CFRPlus<string>::Builder>(cfrplus_str, "Builder")
         .def(py::init<>())
         .def("setRootNode", &CFRPlus<string>::Builder::setRootNode,
@@ -205,23 +876,58 @@ PYBIND11_MODULE(game_algorithms_py, m) {
              py::return_value_policy::reference_internal)
         .def("setInitialState", &CFRPlus<string>::Builder::setInitialState,
              py::return_value_policy::reference_internal)
+        // the map can't be shared with Python without a copy, only between solvers
+        .def("setSharedStateFrom", [](CFRPlus<string>::Builder& builder, CFRPlus<string>& solver)
+                -> CFRPlus<string>::Builder& {
+                 return builder.setSharedState(solver.getSharedInfoSets());
+             }, py::arg("solver"), py::return_value_policy::reference_internal)
+        .def("setPredictive", &CFRPlus<string>::Builder::setPredictive,
+             py::return_value_policy::reference_internal)
+        .def("setChanceSampling", &CFRPlus<string>::Builder::setChanceSampling,
+             py::return_value_policy::reference_internal)
+        .def("setSeed", &CFRPlus<string>::Builder::setSeed,
+             py::return_value_policy::reference_internal)
+        .def("setParallel", &CFRPlus<string>::Builder::setParallel,
+             py::return_value_policy::reference_internal)
+        .def("setThreadCount", &CFRPlus<string>::Builder::setThreadCount,
+             py::return_value_policy::reference_internal)
+        .def("setInfoSetCapacityHint", &CFRPlus<string>::Builder::setInfoSetCapacityHint,
+             py::return_value_policy::reference_internal)
         .def("buildCfr", &CFRPlus<string>::Builder::buildCfr);
 
     auto cfrplus_int = py::class_<CFRPlus<size_t>>(m, "CFRPlusInt")
-        .def(py::init<shared_ptr<const GameNode>, bool, double, const InfoSetMap<size_t>&>(),
+        .def(py::init<shared_ptr<const GameNode>, bool, double, const InfoSetMap<size_t>&,
+                      bool, bool, uint64_t, bool, int, size_t>(),
              py::arg("root_node"), py::arg("initial_evaluation_run") = true,
              py::arg("e_soft_regsum_strategies") = 0.0,
-             py::arg("initial_state") = InfoSetMap<size_t>())
-        .def("evaluateAndUpdate", &CFRPlus<size_t>::evaluateAndUpdate,
+             py::arg("initial_state") = InfoSetMap<size_t>(),
+             py::arg("predictive") = false,
+             py::arg("chance_sampling") = false,
+             py::arg("seed") = 0,
+             py::arg("parallel") = false,
+             py::arg("n_threads") = 0,
+             py::arg("infoset_capacity_hint") = 0)
+        .def("evaluateAndUpdate", &CFRPlus<size_t>::evaluateAndUpdateRegretSum,
              py::arg("accumulate_regsum") = true, py::arg("accumulate_strategy") = true)
-        .def("evaluate", &CFRPlus<size_t>::evaluate)
+        .def("evaluate", &CFRPlus<size_t>::evaluateRegretSum)
         .def("getStrategyInfoSets", &CFRPlus<size_t>::getStrategyInfoSets,
              py::return_value_policy::reference_internal)
+        .def("getCreatedInfoSetCount", &CFRPlus<size_t>::getCreatedInfoSetCount)
+        .def("getRootOutcomeValues", &CFRPlus<size_t>::getRootOutcomeValues)
+        // avoids converting the whole map into a Python dict
+        .def("exportArrays", [](CFRPlus<size_t>& cfr) {
+            return infoset_utils::toArrays(cfr.getStrategyInfoSets());
+        })
+        .def("buildPolicyTable", [](CFRPlus<size_t>& cfr) {
+            return PolicyTable<size_t>(cfr.getStrategyInfoSets());
+        })
         .def("processNode", &CFRPlus<size_t>::processNode,
              py::arg("node"), py::arg("p_past_actions_p0") = 1.0,
              py::arg("p_past_actions_p1") = 1.0, py::arg("p_past_chances") = 1.0,
              py::arg("accumulate_regsum") = false, py::arg("accumulate_strategy") = false);
 
+    bindTraining(cfrplus_int);
+
     py::class_<CFRPlus<size_t>::Builder>(cfrplus_int, "Builder")
         .def(py::init<>())
         .def("setRootNode", &CFRPlus<size_t>::Builder::setRootNode,
@@ -232,6 +938,23 @@ PYBIND11_MODULE(game_algorithms_py, m) {
              py::return_value_policy::reference_internal)
         .def("setInitialState", &CFRPlus<size_t>::Builder::setInitialState,
              py::return_value_policy::reference_internal)
+        // the map can't be shared with Python without a copy, only between solvers
+        .def("setSharedStateFrom", [](CFRPlus<size_t>::Builder& builder, CFRPlus<size_t>& solver)
+                -> CFRPlus<size_t>::Builder& {
+                 return builder.setSharedState(solver.getSharedInfoSets());
+             }, py::arg("solver"), py::return_value_policy::reference_internal)
+        .def("setPredictive", &CFRPlus<size_t>::Builder::setPredictive,
+             py::return_value_policy::reference_internal)
+        .def("setChanceSampling", &CFRPlus<size_t>::Builder::setChanceSampling,
+             py::return_value_policy::reference_internal)
+        .def("setSeed", &CFRPlus<size_t>::Builder::setSeed,
+             py::return_value_policy::reference_internal)
+        .def("setParallel", &CFRPlus<size_t>::Builder::setParallel,
+             py::return_value_policy::reference_internal)
+        .def("setThreadCount", &CFRPlus<size_t>::Builder::setThreadCount,
+             py::return_value_policy::reference_internal)
+        .def("setInfoSetCapacityHint", &CFRPlus<size_t>::Builder::setInfoSetCapacityHint,
+             py::return_value_policy::reference_internal)
         .def("buildCfr", &CFRPlus<size_t>::Builder::buildCfr);
 
     // Strategy utilities
@@ -132,6 +132,24 @@ def test_cfr_simple():
     print(f"Number of information sets {type(infosets)}: {len(infosets)}")
 
 
+def test_cfr_train():
+    print("\n=== Testing native CFR training loop ===")
+
+    cfr = ga.CFRPlusStr(ga.TTTInvariant())
+
+    def on_progress(progress):
+        print(f"Iteration {progress.iteration}/{progress.n_iterations}, "
+              f"Utility: {progress.root_value:.4f}, "
+              f"Positive regrets: {progress.metric.sum_positive_instant_regrets:.4f}")
+
+    done = cfr.train(5, strategy_delay=2, callback=on_progress, callback_interval_seconds=0.0)
+    print(f"Completed iterations: {done}")
+
+    stop = ga.StopSource()
+    stop.requestStop()
+    print(f"Iterations after stop request: {cfr.train(5, stop_source=stop)}")
+
+
 def test_randomizer():
     print("\n=== Testing Randomizer ===")
     
@@ -195,6 +213,18 @@ def test_python_gamenode():
     print(f"Terminal utilities: {list(terminal.getTerminalUtilities())}")
 
 
+def test_tabularize():
+    print("\n=== Testing tabularize ===")
+
+    game = ga.tabularize(SimplePyGameNode(0))
+    print(f"Tabular nodes: {game.getNodeCount()}, info sets: {game.getInfoSetCount()}")
+
+    cfr = ga.CFRPlusStr(game.getRootNode())
+    for i in range(3):
+        utility = cfr.evaluateAndUpdate()
+        print(f"Iteration {i+1}, Utility: {utility:.4f}")
+
+
 def run_all_tests():
     """Run all test functions"""
     try:
@@ -205,8 +235,10 @@ def run_all_tests():
         test_infoset_maps()
         test_strategy_utils()
         test_cfr_simple()
+        test_cfr_train()
         test_randomizer()
         test_python_gamenode()
+        test_tabularize()
         
         print("\n" + "="*50)
         print("🎉 All tests completed successfully!")
@@ -0,0 +1,208 @@
+#include "synthetic/SyntheticGameNode.h"
+#include "Utils.h"
+#include <sstream>
+#include <stdexcept>
+
+namespace {
+    // salts keep the properties derived from one path hash independent
+    enum Salt : uint64_t {
+        TYPE_SALT = 1,
+        TERMINAL_SALT,
+        PLAYER_SALT,
+        INFOSET_SALT,
+        N_ACTIONS_SALT,
+        CHANCE_SALT,
+        UTILITY_SALT
+    };
+
+    uint64_t saltedHash(uint64_t hash, Salt salt) {
+        return cpp_utils::hashCombine(hash, salt);
+    }
+}
+
+
+SyntheticGameNode::SyntheticGameNode()
+    : SyntheticGameNode(Params())
+{ }
+
+SyntheticGameNode::SyntheticGameNode(const Params& params)
+    : SyntheticGameNode(
+        make_shared<const Params>(params), 0, cpp_utils::mixHash(params.seed)
+    )
+{ }
+
+SyntheticGameNode::SyntheticGameNode(
+    shared_ptr<const Params> params,
+    int depth,
+    uint64_t path_hash
+) :
+    params_(params),
+    depth_(depth),
+    path_hash_(path_hash),
+    type_(Type::Terminal),
+    current_player_(-1),
+    infoset_key_(0)
+{
+    if (params_->n_players < 1) {
+        throw invalid_argument("SyntheticGameNode requires at least one player");
+    }
+    if (params_->min_actions < 1 || params_->max_actions < params_->min_actions) {
+        throw invalid_argument("SyntheticGameNode requires 1 <= min_actions <= max_actions");
+    }
+    if (params_->n_chance_outcomes < 1) {
+        throw invalid_argument("SyntheticGameNode requires at least one chance outcome");
+    }
+    calculateProperties();
+}
+
+
+void SyntheticGameNode::calculateProperties() {
+    bool is_terminal = depth_ >= params_->max_depth || (
+        depth_ > 0 &&
+        cpp_utils::hashToUnit(saltedHash(path_hash_, TERMINAL_SALT))
+            < params_->terminal_probability
+    );
+
+    if (is_terminal) {
+        type_ = Type::Terminal;
+        int n_players = params_->n_players;
+        utilities_.resize(n_players);
+
+        uint64_t h = saltedHash(path_hash_, UTILITY_SALT);
+        double sum = 0;
+        for (int p = 0; p < n_players; p++) {
+            h = cpp_utils::mixHash(h);
+            utilities_[p] = 2 * cpp_utils::hashToUnit(h) - 1;
+            sum += utilities_[p];
+        }
+        if (params_->zero_sum) {
+            for (int p = 0; p < n_players; p++) {
+                utilities_[p] -= sum / n_players;
+            }
+        }
+        return;
+    }
+
+    bool is_chance = cpp_utils::hashToUnit(saltedHash(path_hash_, TYPE_SALT))
+        < params_->chance_node_probability;
+
+    if (is_chance) {
+        type_ = Type::Chance;
+        int n_outcomes = params_->n_chance_outcomes;
+        legal_actions_.resize(n_outcomes);
+        chance_probabilities_.resize(n_outcomes);
+
+        uint64_t h = saltedHash(path_hash_, CHANCE_SALT);
+        double sum = 0;
+        for (int a = 0; a < n_outcomes; a++) {
+            h = cpp_utils::mixHash(h);
+            legal_actions_[a] = a;
+            // bounded away from zero so that every outcome is reachable
+            chance_probabilities_[a] = 0.1 + cpp_utils::hashToUnit(h);
+            sum += chance_probabilities_[a];
+        }
+        for (double& p : chance_probabilities_) {
+            p /= sum;
+        }
+        return;
+    }
+
+    type_ = Type::Decision;
+    current_player_ = static_cast<int>(
+        saltedHash(path_hash_, PLAYER_SALT) % params_->n_players
+    );
+
+    // bucket within (depth, player) - aliasing different histories together
+    uint64_t bucket = saltedHash(path_hash_, INFOSET_SALT);
+    if (params_->infosets_per_depth > 0) {
+        bucket %= params_->infosets_per_depth;
+    }
+    infoset_key_ = cpp_utils::hashCombine(
+        cpp_utils::hashCombine(cpp_utils::mixHash(params_->seed), depth_),
+        cpp_utils::hashCombine(current_player_, bucket)
+    );
+
+    // number of actions depends on the info set only
+    int n_actions_range = params_->max_actions - params_->min_actions + 1;
+    int n_actions = params_->min_actions + static_cast<int>(
+        cpp_utils::mixHash(infoset_key_ ^ N_ACTIONS_SALT) % n_actions_range
+    );
+    legal_actions_.resize(n_actions);
+    for (int a = 0; a < n_actions; a++) {
+        legal_actions_[a] = a;
+    }
+}
+
+
+GameNode::Type SyntheticGameNode::getType() const {
+    return type_;
+}
+
+const vector<double>& SyntheticGameNode::getTerminalUtilities() const {
+    if (type_ != Type::Terminal) {
+        throwWrongNodeTypeFnException("getTerminalUtilities");
+    }
+    return utilities_;
+}
+
+const vector<double>& SyntheticGameNode::getChanceProbabilities() const {
+    if (type_ != Type::Chance) {
+        throwWrongNodeTypeFnException("getChanceProbabilities");
+    }
+    return chance_probabilities_;
+}
+
+const vector<int>& SyntheticGameNode::getLegalActions() const {
+    if (type_ == Type::Terminal) {
+        throwWrongNodeTypeFnException("getLegalActions");
+    }
+    return legal_actions_;
+}
+
+shared_ptr<const GameNode> SyntheticGameNode::applyAction(int action) const {
+    if (type_ == Type::Terminal) {
+        throwWrongNodeTypeFnException("applyAction");
+    }
+    if (action < 0 || action >= (int) legal_actions_.size()) {
+        throw logic_error("Illegal action " + to_string(action));
+    }
+    return shared_ptr<const GameNode>(new SyntheticGameNode(
+        params_, depth_ + 1, cpp_utils::hashCombine(path_hash_, action)
+    ));
+}
+
+int SyntheticGameNode::getCurrentPlayer() const {
+    if (type_ != Type::Decision) {
+        throwWrongNodeTypeFnException("getCurrentPlayer");
+    }
+    return current_player_;
+}
+
+string SyntheticGameNode::getInfoSetKeyString() const {
+    return to_string(getInfoSetKeyInt());
+}
+
+size_t SyntheticGameNode::getInfoSetKeyInt() const {
+    if (type_ != Type::Decision) {
+        throwWrongNodeTypeFnException("getInfoSetKeyInt");
+    }
+    return infoset_key_;
+}
+
+string SyntheticGameNode::toString() const {
+    ostringstream oss;
+    oss << getTypeString() << " depth=" << depth_ << " path=" << hex << path_hash_;
+    return oss.str();
+}
+
+const SyntheticGameNode::Params& SyntheticGameNode::getParams() const {
+    return *params_;
+}
+
+int SyntheticGameNode::getDepth() const {
+    return depth_;
+}
+
+uint64_t SyntheticGameNode::getPathHash() const {
+    return path_hash_;
+}
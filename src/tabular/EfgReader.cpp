@@ -0,0 +1,343 @@
+#include "tabular/EfgReader.h"
+#include <fstream>
+#include <map>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace {
+    struct Token {
+        enum class Kind { Word, String, OpenBrace, CloseBrace, End };
+        Kind kind;
+        string text;
+    };
+
+    class Tokenizer {
+    public:
+        Tokenizer(const string& content) : content_(content), pos_(0), line_(1) {
+            advance();
+        }
+
+        const Token& peek() const {
+            return current_;
+        }
+
+        Token next() {
+            Token token = current_;
+            advance();
+            return token;
+        }
+
+        [[noreturn]]
+        void fail(const string& message) const {
+            throw runtime_error(
+                "EFG parse error at line " + to_string(line_) + ": " + message
+            );
+        }
+
+        // returns the text of the expected token
+        string expect(Token::Kind kind, const string& what) {
+            if (current_.kind != kind) {
+                fail("expected " + what + ", got '" + current_.text + "'");
+            }
+            string text = std::move(current_.text);
+            advance();
+            return text;
+        }
+
+        string expectString() {
+            return expect(Token::Kind::String, "quoted string");
+        }
+
+        int expectInt() {
+            string text = expect(Token::Kind::Word, "integer");
+            size_t end = 0;
+            int value = 0;
+            try {
+                value = stoi(text, &end);
+            } catch (const exception&) {
+                end = 0;
+            }
+            if (end != text.size()) {
+                fail("expected integer, got '" + text + "'");
+            }
+            return value;
+        }
+
+        // decimal or rational "a/b"
+        double expectNumber() {
+            string text = expect(Token::Kind::Word, "number");
+            try {
+                size_t slash = text.find('/');
+                if (slash != string::npos) {
+                    return stod(text.substr(0, slash)) / stod(text.substr(slash + 1));
+                }
+                return stod(text);
+            } catch (const exception&) {
+                fail("expected number, got '" + text + "'");
+            }
+        }
+
+    private:
+        void advance() {
+            // commas are optional separators in number lists
+            while (pos_ < content_.size() && (isspace(content_[pos_]) || content_[pos_] == ',')) {
+                if (content_[pos_] == '\n') {
+                    line_++;
+                }
+                pos_++;
+            }
+            if (pos_ >= content_.size()) {
+                current_ = {Token::Kind::End, "<end of file>"};
+                return;
+            }
+
+            char c = content_[pos_];
+            if (c == '{' || c == '}') {
+                pos_++;
+                current_ = {
+                    c == '{' ? Token::Kind::OpenBrace : Token::Kind::CloseBrace,
+                    string(1, c)
+                };
+            } else if (c == '"') {
+                pos_++;
+                string text;
+                while (pos_ < content_.size() && content_[pos_] != '"') {
+                    if (content_[pos_] == '\\' && pos_ + 1 < content_.size()) {
+                        pos_++;
+                    }
+                    if (content_[pos_] == '\n') {
+                        line_++;
+                    }
+                    text += content_[pos_++];
+                }
+                if (pos_ >= content_.size()) {
+                    fail("unterminated string");
+                }
+                pos_++;
+                current_ = {Token::Kind::String, text};
+            } else {
+                size_t start = pos_;
+                while (pos_ < content_.size() && !isspace(content_[pos_]) &&
+                       content_[pos_] != ',' && content_[pos_] != '{' &&
+                       content_[pos_] != '}' && content_[pos_] != '"') {
+                    pos_++;
+                }
+                current_ = {Token::Kind::Word, content_.substr(start, pos_ - start)};
+            }
+        }
+
+        const string& content_;
+        size_t pos_;
+        int line_;
+        Token current_;
+    };
+
+
+    class EfgParser {
+    public:
+        EfgParser(const string& content) : tokens_(content) { }
+
+        shared_ptr<const TabularGame> parse() {
+            parseHeader();
+            TabularGame::Builder builder(n_players_);
+            builder_ = &builder;
+
+            size_t root = parseNode(vector<double>(n_players_, 0.0));
+            if (tokens_.peek().kind != Token::Kind::End) {
+                tokens_.fail("unexpected data after the game tree");
+            }
+            builder.setRoot(root);
+            return builder.build();
+        }
+
+    private:
+        struct ChanceInfoSet {
+            vector<string> action_names;
+            vector<double> probabilities;
+        };
+
+        void parseHeader() {
+            string magic = tokens_.expect(Token::Kind::Word, "EFG");
+            if (magic != "EFG") {
+                tokens_.fail("file does not start with EFG");
+            }
+            if (tokens_.expectInt() != 2) {
+                tokens_.fail("only EFG version 2 is supported");
+            }
+            string precision = tokens_.expect(Token::Kind::Word, "R or D");
+            if (precision != "R" && precision != "D") {
+                tokens_.fail("unknown number format '" + precision + "'");
+            }
+            tokens_.expectString(); // title
+
+            tokens_.expect(Token::Kind::OpenBrace, "'{'");
+            n_players_ = 0;
+            while (tokens_.peek().kind == Token::Kind::String) {
+                tokens_.next();
+                n_players_++;
+            }
+            tokens_.expect(Token::Kind::CloseBrace, "'}'");
+            if (n_players_ == 0) {
+                tokens_.fail("game has no players");
+            }
+
+            // optional comment
+            if (tokens_.peek().kind == Token::Kind::String) {
+                tokens_.next();
+            }
+        }
+
+        // reads "outcome [name {payoffs}]" and returns the outcome payoffs
+        vector<double> parseOutcome() {
+            int outcome = tokens_.expectInt();
+            if (tokens_.peek().kind == Token::Kind::String) {
+                tokens_.next();
+                tokens_.expect(Token::Kind::OpenBrace, "'{'");
+                vector<double> payoffs;
+                while (tokens_.peek().kind == Token::Kind::Word) {
+                    payoffs.push_back(tokens_.expectNumber());
+                }
+                tokens_.expect(Token::Kind::CloseBrace, "'}'");
+                if ((int) payoffs.size() != n_players_) {
+                    tokens_.fail("outcome " + to_string(outcome) + " has wrong number of payoffs");
+                }
+                if (outcome != 0) {
+                    outcomes_[outcome] = payoffs;
+                }
+                return payoffs;
+            }
+
+            if (outcome == 0) {
+                return vector<double>(n_players_, 0.0);
+            }
+            auto it = outcomes_.find(outcome);
+            if (it == outcomes_.end()) {
+                tokens_.fail("outcome " + to_string(outcome) + " used before definition");
+            }
+            return it->second;
+        }
+
+        static void addPayoffs(vector<double>& total, const vector<double>& payoffs) {
+            for (size_t p = 0; p < total.size(); p++) {
+                total[p] += payoffs[p];
+            }
+        }
+
+        size_t parseNode(vector<double> path_payoffs) {
+            string kind = tokens_.expect(Token::Kind::Word, "node type");
+            tokens_.expectString(); // node name
+
+            if (kind == "t") {
+                addPayoffs(path_payoffs, parseOutcome());
+                return builder_->addTerminalNode(path_payoffs);
+            }
+
+            size_t node;
+            size_t n_actions;
+            if (kind == "c") {
+                int infoset_number = tokens_.expectInt();
+                if (tokens_.peek().kind == Token::Kind::String) {
+                    tokens_.next(); // infoset name
+                }
+                if (tokens_.peek().kind == Token::Kind::OpenBrace) {
+                    tokens_.next();
+                    ChanceInfoSet infoset;
+                    while (tokens_.peek().kind == Token::Kind::String) {
+                        infoset.action_names.push_back(tokens_.next().text);
+                        infoset.probabilities.push_back(tokens_.expectNumber());
+                    }
+                    tokens_.expect(Token::Kind::CloseBrace, "'}'");
+                    chance_infosets_[infoset_number] = infoset;
+                }
+
+                auto it = chance_infosets_.find(infoset_number);
+                if (it == chance_infosets_.end()) {
+                    tokens_.fail("chance info set " + to_string(infoset_number) + " has no actions");
+                }
+                n_actions = it->second.action_names.size();
+                vector<int> actions(n_actions);
+                iota(actions.begin(), actions.end(), 0);
+                node = builder_->addChanceNode(
+                    actions, it->second.probabilities, it->second.action_names
+                );
+            } else if (kind == "p") {
+                int player = tokens_.expectInt() - 1;
+                int infoset_number = tokens_.expectInt();
+                if (player < 0 || player >= n_players_) {
+                    tokens_.fail("invalid player " + to_string(player + 1));
+                }
+                if (tokens_.peek().kind == Token::Kind::String) {
+                    tokens_.next(); // infoset name
+                }
+
+                pair<int, int> infoset_id = {player, infoset_number};
+                auto it = infosets_.find(infoset_id);
+                if (tokens_.peek().kind == Token::Kind::OpenBrace) {
+                    tokens_.next();
+                    vector<string> action_names;
+                    while (tokens_.peek().kind == Token::Kind::String) {
+                        action_names.push_back(tokens_.next().text);
+                    }
+                    tokens_.expect(Token::Kind::CloseBrace, "'}'");
+
+                    if (it == infosets_.end()) {
+                        vector<int> actions(action_names.size());
+                        iota(actions.begin(), actions.end(), 0);
+                        size_t dense_id = builder_->getInfoSetCount();
+                        size_t id = builder_->addInfoSet(
+                            player,
+                            to_string(player) + ":" + to_string(infoset_number),
+                            dense_id, actions, action_names
+                        );
+                        it = infosets_.emplace(infoset_id, make_pair(id, action_names.size())).first;
+                    } else if (it->second.second != action_names.size()) {
+                        tokens_.fail("info set " + to_string(infoset_number) + " redefined with different actions");
+                    }
+                }
+                if (it == infosets_.end()) {
+                    tokens_.fail("info set " + to_string(infoset_number) + " has no actions");
+                }
+                n_actions = it->second.second;
+                node = builder_->addDecisionNode(it->second.first);
+            } else {
+                tokens_.fail("unknown node type '" + kind + "'");
+            }
+
+            addPayoffs(path_payoffs, parseOutcome());
+            for (size_t action_idx = 0; action_idx < n_actions; action_idx++) {
+                size_t child = parseNode(path_payoffs);
+                builder_->setChild(node, action_idx, child);
+            }
+            return node;
+        }
+
+        Tokenizer tokens_;
+        TabularGame::Builder* builder_ = nullptr;
+        int n_players_ = 0;
+        map<int, vector<double>> outcomes_;
+        map<int, ChanceInfoSet> chance_infosets_;
+        // (player, infoset number) -> (tabular info set id, number of actions)
+        map<pair<int, int>, pair<size_t, size_t>> infosets_;
+    };
+}
+
+
+shared_ptr<const TabularGame> EfgReader::readFile(const string& filename) {
+    ifstream file(filename);
+    if (!file.is_open()) {
+        throw runtime_error("Could not open file: " + filename);
+    }
+    return read(file);
+}
+
+shared_ptr<const TabularGame> EfgReader::readString(const string& content) {
+    return EfgParser(content).parse();
+}
+
+shared_ptr<const TabularGame> EfgReader::read(istream& input) {
+    string content((istreambuf_iterator<char>(input)), istreambuf_iterator<char>());
+    return readString(content);
+}
@@ -0,0 +1,294 @@
+#include "tabular/TabularGame.h"
+#include <algorithm>
+#include <stdexcept>
+
+
+TabularGameNode::TabularGameNode(const TabularGame* game, size_t index)
+    : game_(game),
+    index_(index)
+{ }
+
+GameNode::Type TabularGameNode::getType() const {
+    return game_->node_type_[index_];
+}
+
+const vector<double>& TabularGameNode::getTerminalUtilities() const {
+    if (getType() != Type::Terminal) {
+        throwWrongNodeTypeFnException("getTerminalUtilities");
+    }
+    return game_->payoffs_[game_->node_slot_[index_]];
+}
+
+const vector<double>& TabularGameNode::getChanceProbabilities() const {
+    if (getType() != Type::Chance) {
+        throwWrongNodeTypeFnException("getChanceProbabilities");
+    }
+    return game_->chance_entries_[game_->node_slot_[index_]].probabilities;
+}
+
+const vector<int>& TabularGameNode::getLegalActions() const {
+    if (getType() == Type::Terminal) {
+        throwWrongNodeTypeFnException("getLegalActions");
+    }
+    return game_->getActionList(index_);
+}
+
+size_t TabularGameNode::actionIndex(int action) const {
+    const vector<int>& actions = getLegalActions();
+    // action lists are usually 0..n-1, then the action is its own index
+    if (action >= 0 && action < (int) actions.size() && actions[action] == action) {
+        return action;
+    }
+    auto it = find(actions.begin(), actions.end(), action);
+    if (it == actions.end()) {
+        throw logic_error("Illegal action " + to_string(action));
+    }
+    return it - actions.begin();
+}
+
+shared_ptr<const GameNode> TabularGameNode::applyAction(int action) const {
+    size_t child = game_->edge_child_[
+        game_->node_first_edge_[index_] + actionIndex(action)
+    ];
+    return game_->getNode(child);
+}
+
+int TabularGameNode::getCurrentPlayer() const {
+    if (getType() != Type::Decision) {
+        throwWrongNodeTypeFnException("getCurrentPlayer");
+    }
+    return game_->infosets_[game_->node_slot_[index_]].player;
+}
+
+string TabularGameNode::getInfoSetKeyString() const {
+    if (getType() != Type::Decision) {
+        throwWrongNodeTypeFnException("getInfoSetKeyString");
+    }
+    return game_->infosets_[game_->node_slot_[index_]].key_string;
+}
+
+size_t TabularGameNode::getInfoSetKeyInt() const {
+    if (getType() != Type::Decision) {
+        throwWrongNodeTypeFnException("getInfoSetKeyInt");
+    }
+    return game_->infosets_[game_->node_slot_[index_]].key_int;
+}
+
+string TabularGameNode::toString() const {
+    string result = getTypeString() + " #" + to_string(index_);
+    if (getType() == Type::Decision) {
+        result += " " + getInfoSetKeyString();
+    }
+    return result;
+}
+
+string TabularGameNode::actionToString(int action) const {
+    const vector<string>* names = nullptr;
+    if (getType() == Type::Decision) {
+        names = &game_->infosets_[game_->node_slot_[index_]].action_names;
+    } else if (getType() == Type::Chance) {
+        names = &game_->chance_entries_[game_->node_slot_[index_]].action_names;
+    }
+    if (names == nullptr || names->empty()) {
+        return GameNode::actionToString(action);
+    }
+    return (*names)[actionIndex(action)];
+}
+
+size_t TabularGameNode::getIndex() const {
+    return index_;
+}
+
+const TabularGame& TabularGameNode::getGame() const {
+    return *game_;
+}
+
+
+
+TabularGame::TabularGame(int n_players)
+    : n_players_(n_players),
+    root_(0)
+{ }
+
+size_t TabularGame::addNode(GameNode::Type type, int slot, size_t n_actions) {
+    size_t index = node_type_.size();
+    node_type_.push_back(type);
+    node_slot_.push_back(slot);
+    node_first_edge_.push_back(edge_child_.size());
+    edge_child_.resize(edge_child_.size() + n_actions, NO_CHILD);
+    return index;
+}
+
+const vector<int>& TabularGame::getActionList(size_t node) const {
+    int slot = node_slot_[node];
+    int action_list = (node_type_[node] == GameNode::Type::Chance) ?
+        chance_entries_[slot].action_list : infosets_[slot].action_list;
+    return action_lists_[action_list];
+}
+
+shared_ptr<const GameNode> TabularGame::getRootNode() const {
+    return getNode(root_);
+}
+
+shared_ptr<const GameNode> TabularGame::getNode(size_t index) const {
+    // aliasing constructor - the node shares ownership of the whole game
+    return shared_ptr<const GameNode>(shared_from_this(), &nodes_.at(index));
+}
+
+int TabularGame::getPlayerCount() const {
+    return n_players_;
+}
+
+size_t TabularGame::getNodeCount() const {
+    return node_type_.size();
+}
+
+size_t TabularGame::getInfoSetCount() const {
+    return infosets_.size();
+}
+
+
+
+TabularGame::Builder::Builder(int n_players)
+    : game_(new TabularGame(n_players))
+{
+    if (n_players < 1) {
+        throw invalid_argument("TabularGame requires at least one player");
+    }
+}
+
+TabularGame& TabularGame::Builder::getGame() const {
+    if (!game_) {
+        throw logic_error("TabularGame::Builder cannot be used after build()");
+    }
+    return *game_;
+}
+
+int TabularGame::Builder::addActionList(const vector<int>& actions) {
+    TabularGame& game = getGame();
+    auto [it, inserted] = action_list_ids_.try_emplace(
+        actions, game.action_lists_.size()
+    );
+    if (inserted) {
+        game.action_lists_.push_back(actions);
+    }
+    return it->second;
+}
+
+size_t TabularGame::Builder::addInfoSet(
+    int player,
+    const string& key_string,
+    size_t key_int,
+    const vector<int>& actions,
+    const vector<string>& action_names
+) {
+    TabularGame& game = getGame();
+    if (player < 0 || player >= game.n_players_) {
+        throw invalid_argument("Invalid player " + to_string(player));
+    }
+    if (!action_names.empty() && action_names.size() != actions.size()) {
+        throw invalid_argument("Action names do not match actions");
+    }
+    game.infosets_.push_back({
+        player, addActionList(actions), key_string, key_int, action_names
+    });
+    return game.infosets_.size() - 1;
+}
+
+size_t TabularGame::Builder::addTerminalNode(const vector<double>& utilities) {
+    TabularGame& game = getGame();
+    if ((int) utilities.size() != game.n_players_) {
+        throw invalid_argument("Terminal utilities do not match the number of players");
+    }
+    auto [it, inserted] = payoff_ids_.try_emplace(
+        utilities, game.payoffs_.size()
+    );
+    if (inserted) {
+        game.payoffs_.push_back(utilities);
+    }
+    return game.addNode(GameNode::Type::Terminal, it->second, 0);
+}
+
+size_t TabularGame::Builder::addChanceNode(
+    const vector<int>& actions,
+    const vector<double>& probabilities,
+    const vector<string>& action_names
+) {
+    TabularGame& game = getGame();
+    if (probabilities.size() != actions.size()) {
+        throw invalid_argument("Chance probabilities do not match actions");
+    }
+    if (!action_names.empty() && action_names.size() != actions.size()) {
+        throw invalid_argument("Action names do not match actions");
+    }
+    int action_list = addActionList(actions);
+    auto [it, inserted] = chance_ids_.try_emplace(
+        make_tuple(action_list, probabilities, action_names),
+        game.chance_entries_.size()
+    );
+    if (inserted) {
+        game.chance_entries_.push_back({action_list, probabilities, action_names});
+    }
+    return game.addNode(GameNode::Type::Chance, it->second, actions.size());
+}
+
+size_t TabularGame::Builder::addDecisionNode(size_t infoset_id) {
+    TabularGame& game = getGame();
+    if (infoset_id >= game.infosets_.size()) {
+        throw invalid_argument("Unknown info set " + to_string(infoset_id));
+    }
+    const InfoSetEntry& infoset = game.infosets_[infoset_id];
+    return game.addNode(
+        GameNode::Type::Decision, infoset_id,
+        game.action_lists_[infoset.action_list].size()
+    );
+}
+
+void TabularGame::Builder::setChild(size_t parent, size_t action_idx, size_t child) {
+    TabularGame& game = getGame();
+    if (parent >= game.getNodeCount() || child >= game.getNodeCount()) {
+        throw invalid_argument("Unknown node index");
+    }
+    if (game.node_type_[parent] == GameNode::Type::Terminal ||
+        action_idx >= game.getActionList(parent).size()) {
+        throw invalid_argument(
+            "Node " + to_string(parent) + " has no action index " + to_string(action_idx)
+        );
+    }
+    game.edge_child_[game.node_first_edge_[parent] + action_idx] = child;
+}
+
+void TabularGame::Builder::setRoot(size_t root) {
+    getGame().root_ = root;
+}
+
+size_t TabularGame::Builder::getNodeCount() const {
+    return getGame().getNodeCount();
+}
+
+size_t TabularGame::Builder::getInfoSetCount() const {
+    return getGame().getInfoSetCount();
+}
+
+shared_ptr<const TabularGame> TabularGame::Builder::build() {
+    if (!game_) {
+        throw logic_error("TabularGame::Builder::build() can only be called once");
+    }
+    if (game_->root_ >= game_->getNodeCount()) {
+        throw invalid_argument("TabularGame has no root node");
+    }
+    for (size_t edge = 0; edge < game_->edge_child_.size(); edge++) {
+        if (game_->edge_child_[edge] == NO_CHILD) {
+            throw invalid_argument("TabularGame has an action without a child node");
+        }
+    }
+
+    game_->nodes_.reserve(game_->getNodeCount());
+    for (size_t index = 0; index < game_->getNodeCount(); index++) {
+        game_->nodes_.push_back(TabularGameNode(game_.get(), index));
+    }
+
+    shared_ptr<const TabularGame> game = game_;
+    game_.reset();
+    return game;
+}
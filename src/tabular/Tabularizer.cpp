@@ -0,0 +1,102 @@
+#include "tabular/Tabularizer.h"
+#include <stdexcept>
+
+
+Tabularizer::Tabularizer(int n_players)
+    : builder_(n_players)
+{ }
+
+shared_ptr<const TabularGame> Tabularizer::tabularize(
+    shared_ptr<const GameNode> root,
+    int n_players
+) {
+    if (!root) {
+        throw invalid_argument("Root node cannot be null");
+    }
+    if (n_players < 0) {
+        n_players = countPlayers(root);
+    }
+
+    Tabularizer tabularizer(n_players);
+    size_t root_idx = tabularizer.addNode(root);
+    tabularizer.builder_.setRoot(root_idx);
+    return tabularizer.builder_.build();
+}
+
+int Tabularizer::countPlayers(shared_ptr<const GameNode> root) {
+    shared_ptr<const GameNode> node = root;
+    while (node->getType() != GameNode::Type::Terminal) {
+        node = node->applyAction(node->getLegalActions().front());
+    }
+    return node->getTerminalUtilities().size();
+}
+
+size_t Tabularizer::getInfoSet(const shared_ptr<const GameNode>& node) {
+    size_t key_int = node->getInfoSetKeyInt();
+    string key_string;
+    try {
+        key_string = node->getInfoSetKeyString();
+    } catch (const logic_error&) {
+        // integer-keyed game, keep keys consistent with infoset_utils::convertKey
+        key_string = to_string(key_int);
+    }
+
+    int player = node->getCurrentPlayer();
+    const vector<int>& actions = node->getLegalActions();
+
+    auto it = infosets_.find(key_string);
+    if (it != infosets_.end()) {
+        if (it->second.player != player || it->second.actions != actions) {
+            throw logic_error(
+                "Nodes of info set " + key_string + " disagree on player or legal actions"
+            );
+        }
+        return it->second.id;
+    }
+
+    vector<string> action_names;
+    action_names.reserve(actions.size());
+    for (int action : actions) {
+        action_names.push_back(node->actionToString(action));
+    }
+    size_t infoset_id = builder_.addInfoSet(
+        player, key_string, key_int, actions, action_names
+    );
+    infosets_.emplace(key_string, InfoSetRecord{infoset_id, player, actions});
+    return infoset_id;
+}
+
+size_t Tabularizer::addNode(const shared_ptr<const GameNode>& node) {
+    size_t node_idx;
+    switch (node->getType()) {
+    case GameNode::Type::Terminal:
+        return builder_.addTerminalNode(node->getTerminalUtilities());
+
+    case GameNode::Type::Chance: {
+        const vector<int>& actions = node->getLegalActions();
+        vector<string> action_names;
+        action_names.reserve(actions.size());
+        for (int action : actions) {
+            action_names.push_back(node->actionToString(action));
+        }
+        node_idx = builder_.addChanceNode(
+            actions, node->getChanceProbabilities(), action_names
+        );
+        break;
+    }
+    case GameNode::Type::Decision:
+        node_idx = builder_.addDecisionNode(getInfoSet(node));
+        break;
+
+    default:
+        throw logic_error("Unexpected type");
+    }
+
+    // copy, the reference may not outlive the next call into the source game
+    vector<int> actions = node->getLegalActions();
+    for (size_t action_idx = 0; action_idx < actions.size(); action_idx++) {
+        size_t child_idx = addNode(node->applyAction(actions[action_idx]));
+        builder_.setChild(node_idx, action_idx, child_idx);
+    }
+    return node_idx;
+}
@@ -1,6 +1,7 @@
 #include <iostream>
 #include <memory>
 #include "cfr/CFRPlus.h"
+#include "cfr/MultiRootCFR.h"
 #include "tictactoe/TTTInvariant.h"
 #include "abstract/nodes/Randomizer.h"
 #include "abstract/infoset/InfoSetUtils.h"
@@ -57,9 +58,12 @@ void training(int n_steps) {
 
 
 void read_results() {
-    auto map_str = infoset_utils::SaveLoader::loadInfoSetMap<string>(
-        "training_output/tic_tac_toe_cpp_regretsum.json",
-        "training_output/tic_tac_toe_cpp_strategy.json"
+    // shared by the evaluations of all boards instead of copied into each solver
+    auto map_str = make_shared<InfoSetMap<string>>(
+        infoset_utils::SaveLoader::loadInfoSetMap<string>(
+            "training_output/tic_tac_toe_cpp_regretsum.json",
+            "training_output/tic_tac_toe_cpp_strategy.json"
+        )
     );
 
 
@@ -88,15 +92,17 @@ void read_results() {
         x_towin_board
     };
 
+    vector<shared_ptr<const GameNode>> nodes;
     for (size_t i = 0; i < boards.size(); i++) {
         cout << "Board: " << board_names[i] << endl;
         cout << "String representation: \n" << boards[i].getNormalForm().toString() << endl;
         shared_ptr<TTTInvariant> node = make_shared<TTTInvariant>(
             TicTacToeNode(boards[i].getNormalForm())
         );
+        nodes.push_back(node);
 
         vector<double> strat_prob = \
-            map_str.at(node->getInfoSetKeyString()).getCumulativeStrategy();
+            map_str->at(node->getInfoSetKeyString()).getCumulativeStrategy();
         vector<int> actions = node->getLegalActions();
 
         cout << "Legal actions: ";
@@ -104,19 +110,17 @@ void read_results() {
             cout << actions[j] << "(p=" << strat_prob[j] << ") ";
         }
         cout << endl;
-
-        double x_board_value = \
-            CFRPlus<>::Builder()
-                .setInitialState(map_str)
-                .setInitialEvaluationRun(false)
-                .setRootNode(node)
-                // .setESoftRegsumStrategies(0.2)
-                .buildCfr()
-                .evaluateRegretSum();
-        
-        cout << "Value X player: " << x_board_value << endl;
         cout << endl;
     }
+
+    // all boards are evaluated in one pass over the shared map
+    vector<double> x_board_values = \
+        MultiRootCFR<string>(nodes, vector<double>(nodes.size(), 1.0), 0, map_str)
+            .evaluateRegretSum();
+
+    for (size_t i = 0; i < boards.size(); i++) {
+        cout << "Board: " << board_names[i] << ", value X player: " << x_board_values[i] << endl;
+    }
 }
 
 
@@ -49,6 +49,15 @@ shared_ptr<const GameNode> TTTInvariant::applyAction(int action) const {
     return make_shared<const TTTInvariant>(normalized_node);
 }
 
+bool TTTInvariant::hasStateHash() const {
+    return true;
+}
+
+uint64_t TTTInvariant::getStateHash() const {
+    // boards are kept in normal form, so symmetric positions share a hash
+    return internal_ttt_node_.getStateHash();
+}
+
 size_t TTTInvariant::getInfoSetKeyInt() const {
     return internal_ttt_node_.getInfoSetKeyInt();
 }
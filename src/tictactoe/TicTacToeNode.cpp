@@ -74,6 +74,19 @@ size_t TicTacToeNode::getInfoSetKeyInt() const {
     return key;
 }
 
+bool TicTacToeNode::hasStateHash() const {
+    return true;
+}
+
+uint64_t TicTacToeNode::getStateHash() const {
+    // base 3 encoding of the cells is unique for every board
+    uint64_t encoding = 0;
+    for (size_t i = 0; i < 9; i++) {
+        encoding = encoding * 3 + (board.get(i) + 1);
+    }
+    return cpp_utils::mixHash(encoding);
+}
+
 const TicTacToeBoard& TicTacToeNode::getBoard() const {
     return board;
 }
\ No newline at end of file
@@ -0,0 +1,65 @@
+#include "abstract/strategy/ActionSampler.h"
+#include "cfr/CFRPlus.h"
+#include "TestUtils.h"
+#include <cmath>
+#include <stdexcept>
+
+using namespace std;
+
+
+shared_ptr<const PolicyTable<size_t>> makePolicy() {
+    CFRPlusInt cfr = CFRPlusInt::Builder().setRootNode(makeLiarsDice(3)).buildCfr();
+    cfr.train(50, 0);
+    return make_shared<PolicyTable<size_t>>(cfr.getStrategyInfoSets());
+}
+
+// Sampled frequencies of every row are within 5 standard deviations of the strategy
+void testFrequencies() {
+    auto policy = makePolicy();
+    ActionSamplerInt sampler(policy);
+    const size_t n_samples = 20000;
+    cpp_utils::CounterRng rng(11);
+    for (size_t row = 0; row < policy->size(); row++) {
+        span<const double> strategy = policy->getRowStrategy(row);
+        vector<size_t> counts(strategy.size(), 0);
+        for (size_t i = 0; i < n_samples; i++) {
+            int action = sampler.sampleRow(row, rng);
+            CHECK(action >= 0 && action < (int) strategy.size());
+            counts[action]++;
+        }
+        for (size_t action = 0; action < strategy.size(); action++) {
+            double p = strategy[action];
+            double tolerance = 5 * sqrt(p * (1 - p) / n_samples) + 1e-12;
+            CHECK_NEAR((double) counts[action] / n_samples, p, tolerance);
+        }
+    }
+}
+
+// Batch sample i is the single sample drawn with counter start_counter + i
+void testBatch() {
+    auto policy = makePolicy();
+    ActionSamplerInt sampler(policy);
+    vector<size_t> keys = policy->getKeys();
+    keys.push_back(policy->getKeys()[0] + 1000000);
+    while (policy->contains(keys.back())) {
+        keys.back()++;
+    }
+    vector<int> actions(keys.size());
+    sampler.sampleBatch(keys, actions, 5, 2, 100);
+    for (size_t i = 0; i + 1 < keys.size(); i++) {
+        cpp_utils::CounterRng rng(5, 2, 100 + i);
+        CHECK(actions[i] == sampler.sample(keys[i], rng));
+    }
+    CHECK(actions.back() == -1);
+
+    cpp_utils::CounterRng rng;
+    CHECK_THROWS(sampler.sample(keys.back(), rng), out_of_range);
+    vector<int> too_small(keys.size() - 1);
+    CHECK_THROWS(sampler.sampleBatch(keys, too_small, 5), invalid_argument);
+}
+
+int main() {
+    testFrequencies();
+    testBatch();
+    return 0;
+}
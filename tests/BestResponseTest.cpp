@@ -0,0 +1,36 @@
+#include "abstract/strategy/BestResponse.h"
+#include "abstract/strategy/Utils.h"
+#include "cfr/CFRPlus.h"
+#include "TestUtils.h"
+
+using namespace std;
+
+
+// Strategy values are the self-play values of evaluateNode, and a best
+// response never does worse than the strategy itself
+void testStrategyValues() {
+    auto root = makeLiarsDice(3);
+    CFRPlusInt cfr = CFRPlusInt::Builder().setRootNode(root).buildCfr();
+    cfr.train(50, 0);
+    const InfoSetMap<size_t>& strategy = cfr.getStrategyInfoSets();
+
+    BestResponseInt best_response(root);
+    BestResponseInt::Result result = best_response.compute(strategy, 1);
+    double value = strategy_utils::evaluateNode(root, strategy);
+    CHECK_NEAR(result.strategy_values[0], value, 1e-12);
+    CHECK_NEAR(result.strategy_values[1], -value, 1e-12);
+    for (int player = 0; player < 2; player++) {
+        CHECK(result.best_response_values[player] >= result.strategy_values[player] - 1e-12);
+    }
+    CHECK_NEAR(result.exploitability, result.nash_conv / 2, 1e-12);
+
+    // the same strategy as a policy table, on several threads
+    BestResponseInt::Result from_policy = best_response.compute(PolicyTable<size_t>(strategy), 4);
+    CHECK_NEAR(from_policy.exploitability, result.exploitability, 1e-12);
+    CHECK_NEAR(from_policy.strategy_values[0], value, 1e-12);
+}
+
+int main() {
+    testStrategyValues();
+    return 0;
+}
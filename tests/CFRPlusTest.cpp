@@ -0,0 +1,195 @@
+#include "cfr/CFRPlus.h"
+#include "abstract/strategy/BestResponse.h"
+#include "TestUtils.h"
+#include <stdexcept>
+
+using namespace std;
+
+
+CFRPlusInt buildParallel(shared_ptr<const GameNode> root, int n_threads) {
+    return CFRPlusInt::Builder()
+        .setRootNode(root)
+        .setParallel(true)
+        .setThreadCount(n_threads)
+        .buildCfr();
+}
+
+// Parallel iterations give bit-identical sums for every thread count
+void testThreadCounts() {
+    auto root = makeLiarsDice(3);
+    CFRPlusInt one_thread = buildParallel(root, 1);
+    CFRPlusInt four_threads = buildParallel(root, 4);
+    for (int i = 0; i < 30; i++) {
+        CHECK(one_thread.evaluateAndUpdateRegretSum() == four_threads.evaluateAndUpdateRegretSum());
+    }
+
+    const InfoSetMap<size_t>& expected = one_thread.getStrategyInfoSets();
+    CHECK(expected.size() == 192);
+    CHECK(four_threads.getStrategyInfoSets().size() == expected.size());
+    for (const auto& [key, infoset] : expected) {
+        const InfoSet& actual = four_threads.getStrategyInfoSets().at(key);
+        CHECK(actual.getRegretSum() == infoset.getRegretSum());
+        CHECK(actual.getCumulativeStrategySum() == infoset.getCumulativeStrategySum());
+    }
+}
+
+// Predictive CFR+ converges, and its parallel iterations are bit-identical
+// for every thread count as well
+void testPredictive() {
+    auto root = makeLiarsDice(3);
+    CFRPlusInt sequential = CFRPlusInt::Builder().setRootNode(root).setPredictive(true).buildCfr();
+    sequential.train(2000, 0);
+    // about 0.2 after 1000 iterations
+    CHECK(BestResponseInt(root).compute(sequential.getStrategyInfoSets()).exploitability < 0.12);
+
+    auto buildPredictive = [&](int n_threads) {
+        return CFRPlusInt::Builder()
+            .setRootNode(root)
+            .setPredictive(true)
+            .setParallel(true)
+            .setThreadCount(n_threads)
+            .buildCfr();
+    };
+    CFRPlusInt one_thread = buildPredictive(1);
+    CFRPlusInt four_threads = buildPredictive(4);
+    CFRPlusInt plain = buildParallel(root, 1);
+    for (int i = 0; i < 30; i++) {
+        CHECK(one_thread.evaluateAndUpdateRegretSum() == four_threads.evaluateAndUpdateRegretSum());
+        plain.evaluateAndUpdateRegretSum();
+    }
+    bool differs_from_plain = false;
+    for (const auto& [key, infoset] : one_thread.getStrategyInfoSets()) {
+        const InfoSet& actual = four_threads.getStrategyInfoSets().at(key);
+        CHECK(actual.getRegretSum() == infoset.getRegretSum());
+        CHECK(actual.getCumulativeStrategySum() == infoset.getCumulativeStrategySum());
+        differs_from_plain |=
+            plain.getStrategyInfoSets().at(key).getCumulativeStrategySum() != infoset.getCumulativeStrategySum();
+    }
+    CHECK(differs_from_plain);
+}
+
+// Parallel and sequential iterations differ in when info sets are updated,
+// both converge to the same game value
+void testMatchesSequential() {
+    auto root = makeLiarsDice(3);
+    CFRPlusInt parallel = buildParallel(root, 2);
+    CFRPlusInt sequential = CFRPlusInt::Builder().setRootNode(root).buildCfr();
+    parallel.train(500, 1);
+    sequential.train(500, 1);
+
+    CHECK_NEAR(parallel.evaluateRegretSum(), sequential.evaluateRegretSum(), 1e-2);
+    CHECK(parallel.getStrategyInfoSets().size() == sequential.getStrategyInfoSets().size());
+    BestResponseInt best_response(root);
+    double parallel_exploitability = best_response.compute(parallel.getStrategyInfoSets()).exploitability;
+    double sequential_exploitability = best_response.compute(sequential.getStrategyInfoSets()).exploitability;
+    CHECK_NEAR(parallel_exploitability, sequential_exploitability, 1e-2);
+    // about 0.49 after 100 iterations
+    CHECK(parallel_exploitability < 0.35);
+}
+
+// A parallel solver on a subgame of a shared map leaves the other info sets alone
+void testSharedMapSubgame() {
+    auto root = makeLiarsDice(3);
+    CFRPlusInt full = CFRPlusInt::Builder().setRootNode(root).buildCfr();
+    full.train(20, 1);
+    shared_ptr<InfoSetMap<size_t>> shared = full.getSharedInfoSets();
+    InfoSetMap<size_t> before = *shared;
+
+    // the first deal, both players know their roll
+    shared_ptr<const GameNode> subgame = root->applyAction(root->getLegalActions()[0]);
+    CFRPlusInt sub = CFRPlusInt::Builder()
+        .setRootNode(subgame)
+        .setSharedState(shared)
+        .setParallel(true)
+        .setThreadCount(2)
+        .buildCfr();
+    for (int i = 0; i < 10; i++) {
+        sub.evaluateAndUpdateRegretSum();
+    }
+
+    CHECK(sub.getCreatedInfoSetCount() == 0);
+    CHECK(shared->size() == before.size());
+    size_t n_changed = 0;
+    for (const auto& [key, infoset] : before) {
+        const InfoSet& actual = shared->at(key);
+        bool changed = actual.getRegretSum() != infoset.getRegretSum()
+            || actual.getInstantRegret() != infoset.getInstantRegret()
+            || actual.getCumulativeStrategySum() != infoset.getCumulativeStrategySum();
+        n_changed += changed;
+    }
+    // each player sees one of the 3 rolls in the subgame
+    CHECK(n_changed == before.size() / 3);
+}
+
+// Sampled iterations skip info sets, the export still has all of them
+void testSampledExport() {
+    auto root = makeLiarsDice(3);
+    CFRPlusInt cfr = CFRPlusInt::Builder()
+        .setRootNode(root)
+        .setInitialEvaluationRun(false)
+        .setChanceSampling(true)
+        .setSeed(3)
+        .buildCfr();
+    cfr.evaluateAndUpdateRegretSum();
+    CHECK(cfr.getCreatedInfoSetCount() < 192);
+
+    CHECK(cfr.getStrategyInfoSets().size() == 192);
+    CHECK(cfr.getCreatedInfoSetCount() == 192);
+}
+
+// Chance-sampled iterations still converge
+void testSampledConverges() {
+    auto root = makeLiarsDice(3);
+    CFRPlusInt cfr = CFRPlusInt::Builder()
+        .setRootNode(root)
+        .setChanceSampling(true)
+        .setSeed(3)
+        .buildCfr();
+    cfr.train(10000, 0);
+    // about 0.21 after 1000 iterations
+    CHECK(BestResponseInt(root).compute(cfr.getStrategyInfoSets()).exploitability < 0.04);
+}
+
+// An initial state is copied into every solver, a shared state is not
+void testBuilderStates() {
+    auto root = makeLiarsDice(3);
+    InfoSetMap<size_t> initial_state = buildParallel(root, 1).getStrategyInfoSets();
+    CFRPlusInt::Builder builder;
+    builder.setRootNode(root).setInitialState(initial_state);
+    initial_state.clear();
+
+    CFRPlusInt first = builder.buildCfr();
+    CFRPlusInt second = builder.buildCfr();
+    CHECK(first.getSharedInfoSets() != second.getSharedInfoSets());
+    first.train(5, 0);
+    CHECK(second.getStrategyInfoSets().size() == 192);
+    CHECK(first.evaluateRegretSum() != second.evaluateRegretSum());
+
+    builder.setSharedState(first.getSharedInfoSets());
+    CFRPlusInt shared = builder.buildCfr();
+    CHECK(shared.getSharedInfoSets() == first.getSharedInfoSets());
+    CHECK(shared.evaluateRegretSum() == first.evaluateRegretSum());
+    builder.setInitialState(InfoSetMap<size_t>());
+    CHECK(builder.buildCfr().getSharedInfoSets() != first.getSharedInfoSets());
+}
+
+void testInvalidOptions() {
+    auto root = makeLiarsDice(3);
+    CHECK_THROWS(CFRPlusInt::Builder().buildCfr(), invalid_argument);
+    CHECK_THROWS(
+        CFRPlusInt::Builder().setRootNode(root).setParallel(true).setChanceSampling(true).buildCfr(),
+        invalid_argument
+    );
+}
+
+int main() {
+    testThreadCounts();
+    testMatchesSequential();
+    testPredictive();
+    testSharedMapSubgame();
+    testSampledExport();
+    testSampledConverges();
+    testBuilderStates();
+    testInvalidOptions();
+    return 0;
+}
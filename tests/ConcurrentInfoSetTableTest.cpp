@@ -0,0 +1,81 @@
+#include "abstract/infoset/ConcurrentInfoSetTable.h"
+#include "abstract/infoset/InfoSet.h"
+#include "TestUtils.h"
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+
+// Threads insert the same keys in different orders and update every entry
+// many times: no entry may be duplicated and no update may be lost.
+void testConcurrentInsertAndUpdate() {
+    const int n_threads = 8;
+    const size_t n_keys = 5000;
+    const int n_rounds = 20;
+    ConcurrentInfoSetTableInt table(2 * n_keys);
+
+    vector<thread> threads;
+    for (int t = 0; t < n_threads; t++) {
+        threads.emplace_back([&table, t]() {
+            const double ones[] = {1.0, 1.0};
+            const double strategy[] = {0.25, 0.75};
+            for (int round = 0; round < n_rounds; round++) {
+                for (size_t i = 0; i < n_keys; i++) {
+                    // every thread walks the keys from a different start
+                    size_t key = (i * 7919 + t * n_keys / n_threads) % n_keys;
+                    auto& entry = table.findOrInsert(key, 2);
+                    entry.accumulateRegret(1.0, ones);
+                    entry.accumulateStrategy(1.0, strategy);
+                }
+            }
+        });
+    }
+    for (thread& t : threads) {
+        t.join();
+    }
+
+    CHECK(table.size() == n_keys);
+    double updates = n_threads * n_rounds;
+    for (size_t key = 0; key < n_keys; key++) {
+        auto* entry = table.find(key);
+        CHECK(entry != nullptr);
+        CHECK(entry->getKey() == key);
+        vector<double> regret_sum = entry->getRegretSum();
+        vector<double> strategy_sum = entry->getCumulativeStrategySum();
+        // sums of small integers and quarters are exact
+        CHECK(regret_sum[0] == InfoSet::INITIAL_REGRET_SUM + updates);
+        CHECK(regret_sum[1] == InfoSet::INITIAL_REGRET_SUM + updates);
+        CHECK(strategy_sum[0] == 0.25 * updates);
+        CHECK(strategy_sum[1] == 0.75 * updates);
+    }
+    CHECK(table.toInfoSetMap().size() == n_keys);
+}
+
+// A new entry exports the same sums as a new InfoSet
+void testInitialSums() {
+    ConcurrentInfoSetTableString table(16);
+    table.findOrInsert("a", 3);
+    InfoSet exported = table.toInfoSetMap().at("a");
+    InfoSet fresh(3);
+    CHECK(exported.getRegretSum() == fresh.getRegretSum());
+    CHECK(exported.getCumulativeStrategySum() == fresh.getCumulativeStrategySum());
+}
+
+void testFullTable() {
+    ConcurrentInfoSetTableInt table(4);
+    for (size_t key = 0; key < table.getCapacity(); key++) {
+        table.findOrInsert(key, 2);
+    }
+    CHECK_THROWS(table.findOrInsert(table.getCapacity(), 2), length_error);
+    // existing keys are still found in a full table
+    CHECK(&table.findOrInsert(0, 2) == table.find(0));
+}
+
+int main() {
+    testConcurrentInsertAndUpdate();
+    testInitialSums();
+    testFullTable();
+    return 0;
+}
@@ -0,0 +1,110 @@
+#include "tabular/EfgReader.h"
+#include "cfr/CFRPlus.h"
+#include "abstract/strategy/BestResponse.h"
+#include "TestUtils.h"
+#include <stdexcept>
+
+using namespace std;
+
+
+// Kuhn poker: J, Q, K dealt to two players, info sets 1-3 are the first
+// decision with each card, 4-6 the decision facing a bet
+const string KUHN_EFG = R"(EFG 2 R "Kuhn poker" { "Player 1" "Player 2" }
+c "" 1 "" { "JQ" 1/6 "JK" 1/6 "QJ" 1/6 "QK" 1/6 "KJ" 1/6 "KQ" 1/6 } 0
+p "" 1 1 "" { "check" "bet" } 0
+p "" 2 2 "" { "check" "bet" } 0
+t "" 1 "" { -1, 1 }
+p "" 1 4 "" { "fold" "call" } 0
+t "" 2 "" { -1, 1 }
+t "" 3 "" { -2, 2 }
+p "" 2 5 "" { "fold" "call" } 0
+t "" 4 "" { 1, -1 }
+t "" 5 "" { -2, 2 }
+p "" 1 1 "" { "check" "bet" } 0
+p "" 2 3 "" { "check" "bet" } 0
+t "" 6 "" { -1, 1 }
+p "" 1 4 "" { "fold" "call" } 0
+t "" 7 "" { -1, 1 }
+t "" 8 "" { -2, 2 }
+p "" 2 6 "" { "fold" "call" } 0
+t "" 9 "" { 1, -1 }
+t "" 10 "" { -2, 2 }
+p "" 1 2 "" { "check" "bet" } 0
+p "" 2 1 "" { "check" "bet" } 0
+t "" 11 "" { 1, -1 }
+p "" 1 5 "" { "fold" "call" } 0
+t "" 12 "" { -1, 1 }
+t "" 13 "" { 2, -2 }
+p "" 2 4 "" { "fold" "call" } 0
+t "" 14 "" { 1, -1 }
+t "" 15 "" { 2, -2 }
+p "" 1 2 "" { "check" "bet" } 0
+p "" 2 3 "" { "check" "bet" } 0
+t "" 16 "" { -1, 1 }
+p "" 1 5 "" { "fold" "call" } 0
+t "" 17 "" { -1, 1 }
+t "" 18 "" { -2, 2 }
+p "" 2 6 "" { "fold" "call" } 0
+t "" 19 "" { 1, -1 }
+t "" 20 "" { -2, 2 }
+p "" 1 3 "" { "check" "bet" } 0
+p "" 2 1 "" { "check" "bet" } 0
+t "" 21 "" { 1, -1 }
+p "" 1 6 "" { "fold" "call" } 0
+t "" 22 "" { -1, 1 }
+t "" 23 "" { 2, -2 }
+p "" 2 4 "" { "fold" "call" } 0
+t "" 24 "" { 1, -1 }
+t "" 25 "" { 2, -2 }
+p "" 1 3 "" { "check" "bet" } 0
+p "" 2 2 "" { "check" "bet" } 0
+t "" 26 "" { 1, -1 }
+p "" 1 6 "" { "fold" "call" } 0
+t "" 27 "" { -1, 1 }
+t "" 28 "" { 2, -2 }
+p "" 2 5 "" { "fold" "call" } 0
+t "" 29 "" { 1, -1 }
+t "" 30 "" { 2, -2 }
+)";
+
+void testKuhn() {
+    shared_ptr<const TabularGame> game = EfgReader::readString(KUHN_EFG);
+    CHECK(game->getPlayerCount() == 2);
+    // the deal, then 4 decisions and 5 terminals for each of the 6 deals
+    CHECK(game->getNodeCount() == 55);
+    CHECK(game->getInfoSetCount() == 12);
+
+    shared_ptr<const GameNode> root = game->getRootNode();
+    CHECK(root->getType() == GameNode::Type::Chance);
+    CHECK(root->getLegalActions().size() == 6);
+    CHECK_NEAR(root->getChanceProbabilities()[0], 1.0 / 6, 1e-15);
+
+    // J against Q, check and bet, fold
+    shared_ptr<const GameNode> node = root->applyAction(0)->applyAction(0)->applyAction(1);
+    CHECK(node->getType() == GameNode::Type::Decision);
+    CHECK(node->getCurrentPlayer() == 0);
+    node = node->applyAction(0);
+    CHECK(node->getType() == GameNode::Type::Terminal);
+    CHECK(node->getTerminalUtilities() == vector<double>({-1, 1}));
+
+    // the game value for the first player is -1/18
+    CFRPlusInt cfr = CFRPlusInt::Builder().setRootNode(root).buildCfr();
+    cfr.train(10000, 0);
+    BestResponseInt::Result result = BestResponseInt(root).compute(cfr.getStrategyInfoSets());
+    // about 0.037 after 1000 iterations
+    CHECK(result.exploitability < 1e-2);
+    CHECK_NEAR(result.strategy_values[0], -1.0 / 18, 1e-2);
+}
+
+void testErrors() {
+    CHECK_THROWS(EfgReader::readString("NFG 2 R \"\" { \"1\" }"), runtime_error);
+    CHECK_THROWS(EfgReader::readString("EFG 2 X \"\" { \"1\" }"), runtime_error);
+    CHECK_THROWS(EfgReader::readString("EFG 2 R \"\" { \"1\" } t \"\" 1"), runtime_error);
+    CHECK_THROWS(EfgReader::readString("EFG 2 R \"\" { \"1\" } p \"\" 1 1 0"), runtime_error);
+}
+
+int main() {
+    testKuhn();
+    testErrors();
+    return 0;
+}
@@ -0,0 +1,34 @@
+#include "abstract/strategy/Utils.h"
+#include "cfr/CFRPlus.h"
+#include "tictactoe/TicTacToeNode.h"
+#include "TestUtils.h"
+
+using namespace std;
+
+
+// Transpositions are evaluated once, with the same value as evaluateNode
+void testTicTacToe() {
+    shared_ptr<const GameNode> root = make_shared<TicTacToeNode>();
+    CFRPlusInt cfr = CFRPlusInt::Builder().setRootNode(root).buildCfr();
+    cfr.train(3, 0);
+    const InfoSetMap<size_t>& strategy = cfr.getStrategyInfoSets();
+    double value = strategy_utils::evaluateNode(root, strategy);
+
+    strategy_utils::MemoizedEvaluation<size_t> memoized =
+        strategy_utils::evaluateNodeMemoized(root, strategy);
+    CHECK_NEAR(memoized.root_value, value, 1e-12);
+    // 549946 nodes on all paths, 5478 distinct boards
+    CHECK(memoized.n_evaluated_states < 549946 / 50);
+    CHECK(memoized.n_cache_hits > 0);
+
+    // a tiny table keeps evicting states, the value is unchanged
+    strategy_utils::MemoizedEvaluation<size_t> evicting =
+        strategy_utils::evaluateNodeMemoized(root, strategy, 16);
+    CHECK_NEAR(evicting.root_value, value, 1e-12);
+    CHECK(evicting.n_evaluated_states > memoized.n_evaluated_states);
+}
+
+int main() {
+    testTicTacToe();
+    return 0;
+}
@@ -0,0 +1,52 @@
+#include "abstract/strategy/HeadToHead.h"
+#include "abstract/strategy/BestResponse.h"
+#include "abstract/strategy/Utils.h"
+#include "cfr/CFRPlus.h"
+#include "TestUtils.h"
+
+using namespace std;
+
+
+shared_ptr<const PolicyTable<size_t>> trainPolicy(shared_ptr<const GameNode> root, int n_iterations) {
+    CFRPlusInt cfr = CFRPlusInt::Builder().setRootNode(root).buildCfr();
+    cfr.train(n_iterations, 0);
+    return make_shared<PolicyTable<size_t>>(cfr.getStrategyInfoSets());
+}
+
+// Self-play matches evaluateNode and the strategy values of BestResponse,
+// the tournament matrix matches single evaluations
+void testMatchesSelfPlay() {
+    auto root = makeLiarsDice(3);
+    CFRPlusInt cfr = CFRPlusInt::Builder().setRootNode(root).buildCfr();
+    cfr.train(50, 0);
+    auto trained = make_shared<PolicyTable<size_t>>(cfr.getStrategyInfoSets());
+    auto weak = trainPolicy(root, 2);
+
+    HeadToHeadInt head_to_head(root);
+    vector<double> utilities = head_to_head.evaluate({trained, trained});
+    double value = strategy_utils::evaluateNode(root, cfr.getStrategyInfoSets());
+    CHECK_NEAR(utilities[0], value, 1e-12);
+    CHECK_NEAR(utilities[1], -value, 1e-12);
+    BestResponseInt::Result result = BestResponseInt(root).compute(*trained);
+    CHECK_NEAR(utilities[0], result.strategy_values[0], 1e-12);
+    CHECK_NEAR(utilities[1], result.strategy_values[1], 1e-12);
+
+    vector<vector<vector<double>>> matrix = head_to_head.evaluateMatrix({trained, weak}, 2);
+    CHECK(matrix.size() == 2 && matrix[0].size() == 2);
+    for (size_t i = 0; i < 2; i++) {
+        for (size_t j = 0; j < 2; j++) {
+            auto policy_i = i == 0 ? trained : weak;
+            auto policy_j = j == 0 ? trained : weak;
+            vector<double> expected = head_to_head.evaluate({policy_i, policy_j});
+            CHECK_NEAR(matrix[i][j][0], expected[0], 1e-12);
+            CHECK_NEAR(matrix[i][j][1], expected[1], 1e-12);
+        }
+    }
+    // no profile beats the best response against the trained second player
+    CHECK(matrix[1][0][0] <= result.best_response_values[0] + 1e-12);
+}
+
+int main() {
+    testMatchesSelfPlay();
+    return 0;
+}
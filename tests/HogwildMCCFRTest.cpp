@@ -0,0 +1,42 @@
+#include "cfr/HogwildMCCFR.h"
+#include "abstract/strategy/BestResponse.h"
+#include "TestUtils.h"
+
+using namespace std;
+
+
+// With one thread the run is deterministic and converges
+void testSingleThreadConverges() {
+    auto root = makeLiarsDice(3);
+    HogwildMCCFRInt first(root, 1 << 12, 1);
+    HogwildMCCFRInt second(root, 1 << 12, 1);
+    first.train(20000, 1);
+    second.train(20000, 1);
+
+    InfoSetMap<size_t> strategy = first.getStrategyInfoSets();
+    for (const auto& [key, infoset] : second.getStrategyInfoSets()) {
+        CHECK(strategy.at(key).getRegretSum() == infoset.getRegretSum());
+    }
+
+    double exploitability = BestResponseInt(root).compute(strategy).exploitability;
+    CHECK(exploitability < 0.05);
+}
+
+// Hogwild threads lose no info sets and still converge
+void testThreadsConverge() {
+    auto root = makeLiarsDice(3);
+    HogwildMCCFRInt cfr(root, 1 << 12, 1);
+    cfr.train(20000, 4);
+
+    CHECK(cfr.getIterationCount() == 20000);
+    InfoSetMap<size_t> strategy = cfr.getStrategyInfoSets();
+    CHECK(strategy.size() == 192);
+    double exploitability = BestResponseInt(root).compute(strategy).exploitability;
+    CHECK(exploitability < 0.05);
+}
+
+int main() {
+    testSingleThreadConverges();
+    testThreadsConverge();
+    return 0;
+}
@@ -0,0 +1,63 @@
+#include "abstract/strategy/LocalBestResponse.h"
+#include "abstract/strategy/BestResponse.h"
+#include "cfr/CFRPlus.h"
+#include "TestUtils.h"
+#include <stdexcept>
+
+using namespace std;
+
+
+// The estimate stays below the exact best response, also when the belief
+// can never be redrawn and every game is still counted
+void testLowerBound() {
+    auto root = makeLiarsDice(3);
+    CFRPlusInt cfr = CFRPlusInt::Builder().setRootNode(root).buildCfr();
+    cfr.train(20, 0);
+    const InfoSetMap<size_t>& infosets = cfr.getStrategyInfoSets();
+    double exploitability = BestResponseInt(root).compute(infosets).exploitability;
+    auto policy = make_shared<PolicyTable<size_t>>(infosets);
+
+    LocalBestResponseInt lbr(root, policy);
+    LocalBestResponseInt::ExploitabilityEstimate estimate = lbr.estimateExploitability(2000, 7, 1);
+    CHECK(estimate.exploitability < exploitability + estimate.confidence_95);
+    CHECK(estimate.exploitability > 0);
+
+    LocalBestResponseInt::Params params;
+    params.n_particles = 1;
+    params.n_resample_histories = 0;
+    LocalBestResponseInt no_resampling(root, policy, params);
+    LocalBestResponseInt::Result result = no_resampling.run(0, 2000, 7, 1);
+    CHECK(result.n_games == 2000);
+    CHECK(result.n_belief_failures > 0);
+    double best_response_value = BestResponseInt(root).compute(infosets).best_response_values[0];
+    CHECK(result.mean_value < best_response_value + result.confidence_95);
+}
+
+// The result of a seed does not depend on the thread count
+void testThreadCounts() {
+    auto root = makeLiarsDice(3);
+    CFRPlusInt cfr = CFRPlusInt::Builder().setRootNode(root).buildCfr();
+    auto policy = make_shared<PolicyTable<size_t>>(cfr.getStrategyInfoSets());
+    LocalBestResponseInt lbr(root, policy);
+    LocalBestResponseInt::Result one_thread = lbr.run(1, 100, 3, 1);
+    LocalBestResponseInt::Result four_threads = lbr.run(1, 100, 3, 4);
+    CHECK(one_thread.mean_value == four_threads.mean_value);
+    CHECK(one_thread.standard_error == four_threads.standard_error);
+    CHECK(one_thread.n_belief_failures == four_threads.n_belief_failures);
+}
+
+void testInvalidArguments() {
+    auto root = makeLiarsDice(3);
+    auto policy = make_shared<PolicyTable<size_t>>(InfoSetMap<size_t>());
+    CHECK_THROWS(LocalBestResponseInt(nullptr, policy), invalid_argument);
+    LocalBestResponseInt::Params params;
+    params.n_rollouts = 0;
+    CHECK_THROWS(LocalBestResponseInt(root, policy, params), invalid_argument);
+}
+
+int main() {
+    testLowerBound();
+    testThreadCounts();
+    testInvalidArguments();
+    return 0;
+}
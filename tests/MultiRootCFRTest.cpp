@@ -0,0 +1,100 @@
+#include "cfr/MultiRootCFR.h"
+#include "TestUtils.h"
+#include <stdexcept>
+
+using namespace std;
+
+
+// the deals of Liar's Dice as separate roots, weighted like the chance root
+struct DealRoots {
+    shared_ptr<const GameNode> game_root;
+    vector<shared_ptr<const GameNode>> roots;
+    vector<double> weights;
+};
+
+DealRoots makeDealRoots() {
+    DealRoots deal;
+    deal.game_root = makeLiarsDice(4);
+    const vector<int>& actions = deal.game_root->getLegalActions();
+    for (size_t i = 0; i < actions.size(); i++) {
+        deal.roots.push_back(deal.game_root->applyAction(actions[i]));
+        // any scale, weights are normalized
+        deal.weights.push_back(7.0 * deal.game_root->getChanceProbabilities()[i]);
+    }
+    return deal;
+}
+
+// Same updates as CFRPlus parallel iterations on the equivalent chance root,
+// for every thread count
+void testMatchesChanceRoot() {
+    DealRoots deal = makeDealRoots();
+    CFRPlusInt reference = CFRPlusInt::Builder()
+        .setRootNode(deal.game_root)
+        .setInitialEvaluationRun(false)
+        .setParallel(true)
+        .setThreadCount(1)
+        .buildCfr();
+    MultiRootCFRInt one_thread(deal.roots, deal.weights, 1);
+    MultiRootCFRInt four_threads(deal.roots, deal.weights, 4);
+
+    vector<double> values_1;
+    vector<double> values_4;
+    double reference_value = 0;
+    for (int i = 0; i < 30; i++) {
+        reference_value = reference.evaluateAndUpdateRegretSum();
+        values_1 = one_thread.evaluateAndUpdateRegretSum();
+        values_4 = four_threads.evaluateAndUpdateRegretSum();
+    }
+
+    CHECK(one_thread.getRootCount() == deal.roots.size());
+    CHECK(values_1.size() == deal.roots.size());
+    CHECK(values_1 == values_4);
+    CHECK(one_thread.getWeightedValue() == reference_value);
+    CHECK(reference.getRootOutcomeValues() == values_1);
+
+    const InfoSetMap<size_t>& expected = reference.getStrategyInfoSets();
+    CHECK(one_thread.getStrategyInfoSets().size() == expected.size());
+    for (const auto& [key, infoset] : expected) {
+        for (auto* solver : {&one_thread, &four_threads}) {
+            const InfoSet& actual = solver->getStrategyInfoSets().at(key);
+            CHECK(actual.getRegretSum() == infoset.getRegretSum());
+            CHECK(actual.getCumulativeStrategySum() == infoset.getCumulativeStrategySum());
+        }
+    }
+}
+
+// Root values equal separate evaluations of every root on the shared map
+void testRootValues() {
+    DealRoots deal = makeDealRoots();
+    MultiRootCFRInt cfr(deal.roots, deal.weights, 2);
+    for (int i = 0; i < 10; i++) {
+        cfr.evaluateAndUpdateRegretSum();
+    }
+    vector<double> values = cfr.evaluateRegretSum();
+
+    for (size_t i = 0; i < deal.roots.size(); i++) {
+        double single = CFRPlusInt::Builder()
+            .setRootNode(deal.roots[i])
+            .setSharedState(cfr.getSharedInfoSets())
+            .setInitialEvaluationRun(false)
+            .buildCfr()
+            .evaluateRegretSum();
+        CHECK_NEAR(values[i], single, 1e-12);
+    }
+}
+
+void testInvalidRoots() {
+    DealRoots deal = makeDealRoots();
+    CHECK_THROWS(MultiRootCFRInt(deal.roots, vector<double>(3, 1.0)), invalid_argument);
+    CHECK_THROWS(MultiRootCFRInt({}, {}), invalid_argument);
+    CHECK_THROWS(
+        MultiRootCFRInt(deal.roots, vector<double>(deal.roots.size(), 0.0)), invalid_argument
+    );
+}
+
+int main() {
+    testMatchesChanceRoot();
+    testRootValues();
+    testInvalidRoots();
+    return 0;
+}
@@ -0,0 +1,95 @@
+#include "cfr/OutOfCoreCFR.h"
+#include "cfr/CFRPlus.h"
+#include "TestUtils.h"
+#include <stdexcept>
+
+using namespace std;
+
+
+// a few segments of one page, so traversals keep spilling
+InfoSetStoreInt::Params makeSmallStore() {
+    InfoSetStoreInt::Params params;
+    params.memory_budget_bytes = 4 * 4096;
+    params.segment_bytes = 4096;
+    return params;
+}
+
+void checkSameSums(const InfoSetMap<size_t>& actual, const InfoSetMap<size_t>& expected) {
+    CHECK(actual.size() == expected.size());
+    for (const auto& [key, infoset] : expected) {
+        CHECK(actual.at(key).getRegretSum() == infoset.getRegretSum());
+        CHECK(actual.at(key).getCumulativeStrategySum() == infoset.getCumulativeStrategySum());
+    }
+}
+
+// Same sums as CFRPlus while the store spills to disk
+void testMatchesCFRPlus() {
+    auto root = makeLiarsDice(4);
+    CFRPlusInt reference = CFRPlusInt::Builder().setRootNode(root).buildCfr();
+    OutOfCoreCFRInt cfr(root, makeSmallStore());
+    for (int i = 0; i < 20; i++) {
+        CHECK(cfr.evaluateAndUpdateRegretSum() == reference.evaluateAndUpdateRegretSum());
+    }
+    CHECK(cfr.evaluateRegretSum() == reference.evaluateRegretSum());
+    checkSameSums(cfr.getStrategyInfoSets(), reference.getStrategyInfoSets());
+
+    InfoSetStoreInt::Statistics statistics = cfr.getStatistics();
+    CHECK(statistics.n_infosets == 1024);
+    CHECK(statistics.spilled_segments > 0);
+    CHECK(statistics.n_faults > 0);
+}
+
+// A partial initial state is completed on the first visits as in CFRPlus
+void testPartialInitialState() {
+    auto root = makeLiarsDice(4);
+    CFRPlusInt trained = CFRPlusInt::Builder().setRootNode(root).buildCfr();
+    trained.train(10, 1);
+    InfoSetMap<size_t> partial;
+    for (const auto& [key, infoset] : trained.getStrategyInfoSets()) {
+        if (key % 2 == 0) {
+            partial.emplace(key, infoset);
+        }
+    }
+
+    CFRPlusInt reference = CFRPlusInt::Builder().setRootNode(root).setInitialState(partial).buildCfr();
+    OutOfCoreCFRInt cfr(root, makeSmallStore(), partial);
+    for (int i = 0; i < 5; i++) {
+        CHECK(cfr.evaluateAndUpdateRegretSum() == reference.evaluateAndUpdateRegretSum());
+    }
+    checkSameSums(cfr.getStrategyInfoSets(), reference.getStrategyInfoSets());
+
+    InfoSetMap<size_t> wrong_actions = partial;
+    size_t wrong_key = wrong_actions.begin()->first;
+    wrong_actions.erase(wrong_key);
+    wrong_actions.emplace(wrong_key, InfoSet(99));
+    OutOfCoreCFRInt wrong(root, makeSmallStore(), wrong_actions);
+    CHECK_THROWS(wrong.evaluateRegretSum(), logic_error);
+}
+
+// Keys are returned by id in insertion order
+void testStoreKeys() {
+    InfoSetStoreString::Params params;
+    params.segment_bytes = 4096;
+    InfoSetStoreString store(params);
+    vector<double> sums = {1, 2};
+    CHECK(store.insert("b", sums, sums) == 0);
+    CHECK(store.insert("a", sums, sums) == 1);
+    CHECK(store.insert("b", sums, sums) == 0);
+    // rehashing keeps the keys in place
+    for (int i = 0; i < 1000; i++) {
+        store.insert(to_string(i), sums, sums);
+    }
+    CHECK(store.size() == 1002);
+    CHECK(store.getKey(0) == "b");
+    CHECK(store.getKey(1) == "a");
+    CHECK(store.getKey(1001) == "999");
+    CHECK(store.find("999") == 1001);
+    CHECK(store.find("missing") == InfoSetStoreString::NOT_FOUND);
+}
+
+int main() {
+    testMatchesCFRPlus();
+    testPartialInitialState();
+    testStoreKeys();
+    return 0;
+}
@@ -0,0 +1,105 @@
+#include "cfr/ShardedCFR.h"
+#include "cfr/CFRPlus.h"
+#include "TestUtils.h"
+#include <stdexcept>
+
+using namespace std;
+
+
+// Terminals below the first deal throw once the process has evaluated
+// enough of them, so the workers holding those items fail mid-training
+// while the others keep going
+int n_failing_terminals = 0;
+
+class FailingNode : public GameNode {
+public:
+    FailingNode(shared_ptr<const GameNode> node, bool is_root, bool failing)
+        : node_(node), is_root_(is_root), failing_(failing) { }
+
+    Type getType() const override { return node_->getType(); }
+
+    const vector<double>& getTerminalUtilities() const override {
+        if (failing_ && ++n_failing_terminals > 1000) {
+            throw runtime_error("terminal failed");
+        }
+        return node_->getTerminalUtilities();
+    }
+    const vector<double>& getChanceProbabilities() const override {
+        return node_->getChanceProbabilities();
+    }
+    const vector<int>& getLegalActions() const override { return node_->getLegalActions(); }
+    shared_ptr<const GameNode> applyAction(int action) const override {
+        bool failing = failing_ || (is_root_ && action == getLegalActions()[0]);
+        return make_shared<FailingNode>(node_->applyAction(action), false, failing);
+    }
+    int getCurrentPlayer() const override { return node_->getCurrentPlayer(); }
+    size_t getInfoSetKeyInt() const override { return node_->getInfoSetKeyInt(); }
+
+private:
+    shared_ptr<const GameNode> node_;
+    bool is_root_;
+    bool failing_;
+};
+
+// Same updates as CFRPlus parallel iterations, up to the summation order
+void testMatchesCFRPlus() {
+    auto root = makeLiarsDice(3);
+    CFRPlusInt reference = CFRPlusInt::Builder()
+        .setRootNode(root)
+        .setInitialEvaluationRun(false)
+        .setParallel(true)
+        .setThreadCount(1)
+        .buildCfr();
+    ShardedCFRInt one_worker(root, 1);
+    ShardedCFRInt three_workers(root, 3);
+
+    double reference_value = 0;
+    for (int i = 0; i < 20; i++) {
+        reference_value = reference.evaluateAndUpdateRegretSum();
+    }
+    CHECK_NEAR(one_worker.train(20), reference_value, 1e-12);
+    // in two calls, workers are started again for the second one
+    three_workers.train(5);
+    CHECK_NEAR(three_workers.train(15), reference_value, 1e-12);
+
+    const InfoSetMap<size_t>& expected = reference.getStrategyInfoSets();
+    CHECK(three_workers.getInfoSetCount() == expected.size());
+    size_t n_sharded = 0;
+    for (int worker = 0; worker < three_workers.getWorkerCount(); worker++) {
+        n_sharded += three_workers.getShardSize(worker);
+    }
+    CHECK(n_sharded == expected.size());
+
+    for (ShardedCFRInt* cfr : {&one_worker, &three_workers}) {
+        InfoSetMap<size_t> actual = cfr->getStrategyInfoSets();
+        CHECK(actual.size() == expected.size());
+        for (const auto& [key, infoset] : expected) {
+            const InfoSet& sharded = actual.at(key);
+            for (size_t i = 0; i < infoset.getRegretSum().size(); i++) {
+                CHECK_NEAR(sharded.getRegretSum()[i], infoset.getRegretSum()[i], 1e-9);
+                CHECK_NEAR(
+                    sharded.getCumulativeStrategySum()[i], infoset.getCumulativeStrategySum()[i], 1e-9
+                );
+            }
+        }
+    }
+}
+
+// A worker failing mid-training stops all workers and train throws
+void testWorkerError() {
+    auto root = make_shared<FailingNode>(makeLiarsDice(3), true, false);
+    ShardedCFRInt cfr(root, 3);
+    CHECK_THROWS(cfr.train(50), runtime_error);
+}
+
+void testInvalidArguments() {
+    CHECK_THROWS(ShardedCFRInt(nullptr, 2), invalid_argument);
+    CHECK_THROWS(ShardedCFRInt(makeLiarsDice(3), 0), invalid_argument);
+}
+
+int main() {
+    testMatchesCFRPlus();
+    testWorkerError();
+    testInvalidArguments();
+    return 0;
+}
@@ -0,0 +1,45 @@
+#include "abstract/strategy/Simulator.h"
+#include "abstract/strategy/BestResponse.h"
+#include "cfr/CFRPlus.h"
+#include "TestUtils.h"
+#include <stdexcept>
+
+using namespace std;
+
+
+shared_ptr<const PolicyTable<size_t>> makePolicy(shared_ptr<const GameNode> root) {
+    CFRPlusInt cfr = CFRPlusInt::Builder().setRootNode(root).buildCfr();
+    cfr.train(20, 0);
+    return make_shared<PolicyTable<size_t>>(cfr.getStrategyInfoSets());
+}
+
+// The result of a seed does not depend on the thread count, and the mean
+// is within its confidence interval of the exact strategy value
+void testThreadCounts() {
+    auto root = makeLiarsDice(3);
+    auto policy = makePolicy(root);
+    SimulatorInt simulator(root, {policy, policy});
+    SimulatorInt::Result one_thread = simulator.run(10000, 5, 1);
+    SimulatorInt::Result four_threads = simulator.run(10000, 5, 4);
+    CHECK(one_thread.n_games == 10000);
+    CHECK(one_thread.mean_utilities == four_threads.mean_utilities);
+    CHECK(one_thread.standard_errors == four_threads.standard_errors);
+    CHECK(one_thread.confidence_95 == four_threads.confidence_95);
+
+    double value = BestResponseInt(root).compute(*policy).strategy_values[0];
+    CHECK_NEAR(one_thread.mean_utilities[0], value, 2 * one_thread.confidence_95[0]);
+}
+
+void testMissingInfoSet() {
+    auto root = makeLiarsDice(3);
+    auto empty = make_shared<PolicyTable<size_t>>(InfoSetMap<size_t>());
+    CHECK_THROWS(SimulatorInt(root, {empty, empty}).run(10, 0, 1), out_of_range);
+    SimulatorInt uniform(root, {empty, empty}, MissingInfoSet::Uniform);
+    CHECK(uniform.run(10, 0, 1).n_games == 10);
+}
+
+int main() {
+    testThreadCounts();
+    testMissingInfoSet();
+    return 0;
+}
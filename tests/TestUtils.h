@@ -0,0 +1,51 @@
+#pragma once
+
+#include "liars_dice/LiarsDiceNode.h"
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+
+// Checks for the test executables: a failed check prints its location
+// and ends the test with a non-zero exit status.
+
+#define CHECK(condition) \
+    do { \
+        if (!(condition)) { \
+            std::cerr << __FILE__ << ":" << __LINE__ << ": CHECK(" #condition ") failed" << std::endl; \
+            std::exit(1); \
+        } \
+    } while (false)
+
+#define CHECK_NEAR(actual, expected, tolerance) \
+    do { \
+        double actual_value = (actual); \
+        double expected_value = (expected); \
+        if (!(std::abs(actual_value - expected_value) <= (tolerance))) { \
+            std::cerr << __FILE__ << ":" << __LINE__ << ": " #actual " = " << actual_value \
+                      << ", expected " << expected_value << " +- " << (tolerance) << std::endl; \
+            std::exit(1); \
+        } \
+    } while (false)
+
+#define CHECK_THROWS(statement, exception_type) \
+    do { \
+        bool thrown = false; \
+        try { \
+            statement; \
+        } catch (const exception_type&) { \
+            thrown = true; \
+        } \
+        if (!thrown) { \
+            std::cerr << __FILE__ << ":" << __LINE__ << ": " #statement " did not throw " \
+                      #exception_type << std::endl; \
+            std::exit(1); \
+        } \
+    } while (false)
+
+// Liar's Dice with one die per player, the game most tests train on
+inline shared_ptr<const GameNode> makeLiarsDice(int n_faces) {
+    LiarsDiceNode::Params params;
+    params.dice_per_player = 1;
+    params.n_faces = n_faces;
+    return make_shared<LiarsDiceNode>(params);
+}
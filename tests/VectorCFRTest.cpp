@@ -0,0 +1,47 @@
+#include "cfr/VectorCFR.h"
+#include "cfr/CFRPlus.h"
+#include "abstract/strategy/BestResponse.h"
+#include "liars_dice/LiarsDicePublicNode.h"
+#include "TestUtils.h"
+
+using namespace std;
+
+
+shared_ptr<const PublicTreeNode> makePublicLiarsDice(int n_faces) {
+    LiarsDiceNode::Params params;
+    params.dice_per_player = 1;
+    params.n_faces = n_faces;
+    return make_shared<LiarsDicePublicNode>(params);
+}
+
+// Same info sets and root value as CFRPlus, and the iterates converge alike
+void testMatchesCFRPlus() {
+    auto root = makeLiarsDice(3);
+    VectorCFRInt vector_cfr(makePublicLiarsDice(3));
+    CFRPlusInt reference = CFRPlusInt::Builder().setRootNode(root).buildCfr();
+    CHECK_NEAR(vector_cfr.evaluateRegretSum(), reference.evaluateRegretSum(), 1e-12);
+
+    const InfoSetMap<size_t>& infosets = vector_cfr.getStrategyInfoSets();
+    const InfoSetMap<size_t>& expected = reference.getStrategyInfoSets();
+    CHECK(infosets.size() == 192);
+    CHECK(expected.size() == infosets.size());
+    for (const auto& [key, infoset] : expected) {
+        CHECK(infosets.contains(key));
+        CHECK(infosets.at(key).getRegretSum().size() == infoset.getRegretSum().size());
+    }
+
+    for (int i = 0; i < 200; i++) {
+        vector_cfr.evaluateAndUpdateRegretSum();
+        reference.evaluateAndUpdateRegretSum();
+    }
+    BestResponseInt best_response(root);
+    double exploitability = best_response.compute(vector_cfr.getStrategyInfoSets()).exploitability;
+    double reference_exploitability = best_response.compute(reference.getStrategyInfoSets()).exploitability;
+    CHECK_NEAR(exploitability, reference_exploitability, 1e-2);
+    CHECK_NEAR(vector_cfr.evaluateRegretSum(), reference.evaluateRegretSum(), 1e-2);
+}
+
+int main() {
+    testMatchesCFRPlus();
+    return 0;
+}